@@ -0,0 +1,284 @@
+#include "beambot.h"
+#include "pool.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <SDL.h>
+
+typedef struct {
+    tetris_bitboard_t board;
+    tetris_placement_t first;	/* Placement of the current piece this path started with. */
+    int lines;
+    double value;
+} beam_node_t;
+
+struct tetris_beambot {
+    tetris_pool_t *pool;
+    int width, lookahead;
+    beambot_weights_t weights;
+
+    beam_node_t *beam;			/* width entries */
+    beam_node_t *children;		/* width * BITBOARD_MAX_PLACEMENTS entries, one stripe per task */
+    int *child_counts;
+    int beam_count;
+    int level;					/* Level being expanded; 0 places the current piece. */
+    tetris_shape_kind_t piece;
+    uint64_t deadline;			/* SDL_GetTicks time the search must end by.	*/
+    SDL_atomic_t expired;		/* Set once a task sees the deadline pass.		*/
+    double select_ms_per_child;	/* Cost of the last beambot_select, to predict the next one. */
+
+    uint64_t *seen;				/* Open addressed board hashes, for dropping duplicates. */
+    int seen_mask;
+
+    /* Statistics */
+    uint64_t searches, cut_short, levels, nodes, ticks;
+};
+
+void beambot_default_weights(beambot_weights_t *weights) {
+    weights->aggregate_height = -0.51;
+    weights->holes = -0.36;
+    weights->bumpiness = -0.18;
+    weights->lines = 0.76;
+}
+
+static double beambot_evaluate(const beambot_weights_t *weights, const tetris_bitboard_t *board) {
+    int heights[BITBOARD_COLUMNS] = {0};
+    uint16_t found = 0;
+
+    int row;
+    for (row = 0; row < BITBOARD_ROWS && found != BITBOARD_FULL_ROW; ++row) {
+        const uint16_t fresh = board->rows[row] & (uint16_t) ~found;
+        if (fresh == 0) {
+            continue;
+        }
+
+        int col;
+        for (col = 0; col < BITBOARD_COLUMNS; ++col) {
+            if (fresh & (1u << col)) {
+                heights[col] = BITBOARD_ROWS - row;
+            }
+        }
+        found |= fresh;
+    }
+
+    int col, aggregate = heights[0], bumpiness = 0;
+    for (col = 1; col < BITBOARD_COLUMNS; ++col) {
+        aggregate += heights[col];
+        bumpiness += abs(heights[col] - heights[col - 1]);
+    }
+
+    return weights->aggregate_height * aggregate + weights->holes * bitboard_holes(board) +
+           weights->bumpiness * bumpiness;
+}
+
+static void beambot_expand_task(void *data, int index) {
+    tetris_beambot_t *bot = data;
+    const beam_node_t *parent = &bot->beam[index];
+    beam_node_t *out = &bot->children[index * BITBOARD_MAX_PLACEMENTS];
+
+    /* Past the first piece a level may be abandoned: once the deadline passes
+     * the remaining parents are skipped and the caller drops the whole level. */
+    if (bot->level > 0 && (SDL_AtomicGet(&bot->expired) || SDL_GetTicks() >= bot->deadline)) {
+        SDL_AtomicSet(&bot->expired, 1);
+        bot->child_counts[index] = 0;
+        return;
+    }
+
+    tetris_placement_t placements[BITBOARD_MAX_PLACEMENTS];
+    const tetris_orientation_t *orientations[BITBOARD_MAX_PLACEMENTS];
+    const int count = bitboard_enumerate(&parent->board, bot->piece, placements, orientations);
+
+    int i;
+    for (i = 0; i < count; ++i) {
+        beam_node_t *child = &out[i];
+
+        child->board = parent->board;
+        child->lines = parent->lines + bitboard_place(&child->board, orientations[i], placements[i].x - 1, placements[i].y - 1);
+        child->first = bot->level == 0 ? placements[i] : parent->first;
+        child->value = bot->weights.lines * child->lines + beambot_evaluate(&bot->weights, &child->board);
+    }
+
+    bot->child_counts[index] = count;
+}
+
+static int compare_nodes(const void *a, const void *b) {
+    const double left = ((const beam_node_t *) a)->value;
+    const double right = ((const beam_node_t *) b)->value;
+    return (left < right) - (left > right);
+}
+
+/* Whether the board was already kept at this level; marks it if not. */
+static bool beambot_seen(tetris_beambot_t *bot, const tetris_bitboard_t *board) {
+    const uint64_t hash = bitboard_hash(board) | 1;
+
+    int slot = (int) (hash & (uint64_t) bot->seen_mask);
+    for (; bot->seen[slot] != 0; slot = (slot + 1) & bot->seen_mask) {
+        if (bot->seen[slot] == hash) {
+            return true;
+        }
+    }
+
+    bot->seen[slot] = hash;
+    return false;
+}
+
+/* Gathers the children of every task into the beam, best first. */
+static int beambot_select(tetris_beambot_t *bot) {
+    const int parents = bot->beam_count;
+    int i, total = 0;
+
+    for (i = 0; i < parents; ++i) {
+        const int count = bot->child_counts[i];
+        if (count > 0) {
+            memmove(&bot->children[total], &bot->children[i * BITBOARD_MAX_PLACEMENTS], sizeof(*bot->children) * count);
+            total += count;
+        }
+    }
+
+    const uint64_t begin = SDL_GetPerformanceCounter();
+
+    bot->nodes += total;
+    qsort(bot->children, total, sizeof(*bot->children), compare_nodes);
+    memset(bot->seen, 0, sizeof(*bot->seen) * (bot->seen_mask + 1));
+
+    /* Different paths often reach the same board; keep one of each. */
+    int kept = 0;
+    for (i = 0; i < total && kept < bot->width; ++i) {
+        if (!beambot_seen(bot, &bot->children[i].board)) {
+            bot->beam[kept++] = bot->children[i];
+        }
+    }
+
+    if (total > 0) {
+        bot->select_ms_per_child = (double) (SDL_GetPerformanceCounter() - begin) * 1000.0
+                                   / (double) SDL_GetPerformanceFrequency() / total;
+    }
+
+    return kept;
+}
+
+tetris_beambot_t *beambot_create(int width, int lookahead, int threads) {
+    tetris_beambot_t *bot = calloc(1, sizeof(*bot));
+    if (bot == NULL)
+        return NULL;
+
+    bot->width = width > 0 ? (width < BEAM_WIDTH_MAX ? width : BEAM_WIDTH_MAX) : BEAM_WIDTH_DEFAULT;
+    bot->lookahead = lookahead >= 0 ? (lookahead < PIECE_QUEUE_SIZE ? lookahead : PIECE_QUEUE_SIZE) : BEAM_LOOKAHEAD_DEFAULT;
+    beambot_default_weights(&bot->weights);
+
+    int capacity = 1;
+    while (capacity < bot->width * 4) {
+        capacity *= 2;
+    }
+    bot->seen_mask = capacity - 1;
+
+    bitboard_init_tables();
+
+    bot->beam = malloc(sizeof(*bot->beam) * bot->width);
+    bot->children = malloc(sizeof(*bot->children) * bot->width * BITBOARD_MAX_PLACEMENTS);
+    bot->child_counts = malloc(sizeof(*bot->child_counts) * bot->width);
+    bot->seen = malloc(sizeof(*bot->seen) * capacity);
+    bot->pool = pool_create(threads);
+
+    if (bot->beam == NULL || bot->children == NULL || bot->child_counts == NULL || bot->seen == NULL || bot->pool == NULL) {
+        puts("Failed to allocate the beam search bot");
+        beambot_destroy(bot);
+        return NULL;
+    }
+
+    return bot;
+}
+
+void beambot_set_weights(tetris_beambot_t *bot, const beambot_weights_t *weights) {
+    bot->weights = *weights;
+}
+
+bool beambot_search(tetris_beambot_t *bot, const tetris_bitboard_t *board, const tetris_shape_kind_t *pieces,
+                    int count, uint64_t deadline, tetris_placement_t *placement) {
+    const uint64_t begin = SDL_GetPerformanceCounter();
+
+    if (count > bot->lookahead + 1) {
+        count = bot->lookahead + 1;
+    }
+
+    bot->beam[0].board = *board;
+    bot->beam[0].lines = 0;
+    bot->beam_count = 1;
+
+    bot->deadline = deadline;
+    SDL_AtomicSet(&bot->expired, 0);
+
+    bot->level = 0;
+    bot->piece = pieces[0];
+    pool_run(bot->pool, 1, beambot_expand_task, bot);
+    bot->beam_count = beambot_select(bot);
+
+    if (bot->beam_count == 0) {
+        return false;
+    }
+
+    *placement = bot->beam[0].first;
+    bot->levels += 1;
+    bot->searches += 1;
+
+    int level;
+    for (level = 1; level < count; ++level) {
+        if (SDL_GetTicks() >= deadline) {
+            bot->cut_short += 1;
+            break;
+        }
+
+        bot->level = level;
+        bot->piece = pieces[level];
+        pool_run(bot->pool, bot->beam_count, beambot_expand_task, bot);
+
+        int children = 0, i;
+        for (i = 0; i < bot->beam_count; ++i) {
+            children += bot->child_counts[i];
+        }
+
+        /* A partly expanded level is biased toward the parents that ran, and sorting
+         * a full one must not run past the deadline either; the previous answer stands. */
+        if (SDL_AtomicGet(&bot->expired) || SDL_GetTicks() + bot->select_ms_per_child * children >= deadline) {
+            bot->cut_short += 1;
+            break;
+        }
+
+        const int kept = beambot_select(bot);
+        if (kept == 0) {
+            /* Every line tops out; the best move of the previous level stands. */
+            break;
+        }
+
+        bot->beam_count = kept;
+        *placement = bot->beam[0].first;
+        bot->levels += 1;
+    }
+
+    bot->ticks += SDL_GetPerformanceCounter() - begin;
+
+    return true;
+}
+
+void beambot_destroy(tetris_beambot_t *bot) {
+    if (bot == NULL) {
+        return;
+    }
+
+    if (bot->searches > 0) {
+        printf("Beam bot: %llu moves, %.2f levels and %.0f boards per move, %.3f ms per move, %llu cut short by the deadline\n",
+               (unsigned long long) bot->searches, (double) bot->levels / (double) bot->searches,
+               (double) bot->nodes / (double) bot->searches,
+               (double) bot->ticks * 1000.0 / (double) SDL_GetPerformanceFrequency() / (double) bot->searches,
+               (unsigned long long) bot->cut_short);
+    }
+
+    pool_destroy(bot->pool);
+    free(bot->beam);
+    free(bot->children);
+    free(bot->child_counts);
+    free(bot->seen);
+    free(bot);
+}
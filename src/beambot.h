@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "bitboard.h"
+
+/**
+ * Built-in bot. Runs a beam search over placements of the current piece and
+ * the known upcoming pieces: every level expands each board in the beam by
+ * all hard-drop placements of the next piece, scores the results and keeps
+ * the best beam_width of them. The move played is the first placement on the
+ * path to the best board of the deepest level finished before the deadline.
+ *
+ * Expanding a level is split across a worker pool, one beam entry per task.
+ */
+
+#define BEAM_WIDTH_DEFAULT (64)
+#define BEAM_WIDTH_MAX (1024)
+#define BEAM_LOOKAHEAD_DEFAULT (2)	/* Queue pieces searched beyond the current one.	*/
+
+/* Board evaluation: a weighted sum, higher is better. */
+typedef struct {
+    double aggregate_height;	/* Sum of column heights.							*/
+    double holes;
+    double bumpiness;			/* Sum of height differences between columns.		*/
+    double lines;				/* Per row cleared along the path.					*/
+} beambot_weights_t;
+
+void beambot_default_weights(beambot_weights_t *weights);
+
+/* Zero or less picks the default for width and threads. */
+tetris_beambot_t *beambot_create(int width, int lookahead, int threads);
+
+void beambot_set_weights(tetris_beambot_t *bot, const beambot_weights_t *weights);
+
+/**
+ * Picks a placement for pieces[0] with pieces[1..count-1] known to follow.
+ * Levels past the first are only started while SDL_GetTicks() is before the
+ * deadline. Returns false when the piece has nowhere to go.
+ */
+bool beambot_search(tetris_beambot_t *bot, const tetris_bitboard_t *board, const tetris_shape_kind_t *pieces,
+                    int count, uint64_t deadline, tetris_placement_t *placement);
+
+/* Prints the search summary. */
+void beambot_destroy(tetris_beambot_t *bot);
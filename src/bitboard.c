@@ -0,0 +1,228 @@
+#include "bitboard.h"
+
+#include <string.h>
+
+static tetris_shape_orientations_t g_orientations[SHAPE_END];
+static int g_rotation_index[SHAPE_END][4];	/* Orientation each rotation looks like. */
+static bool g_tables_ready = false;
+
+void bitboard_init_tables(void) {
+    if (g_tables_ready) {
+        return;
+    }
+
+    int shape;
+    for (shape = 0; shape < SHAPE_END; ++shape) {
+        tetris_shape_orientations_t *entry = &g_orientations[shape];
+        entry->count = 0;
+
+        int rotation;
+        for (rotation = 0; rotation < 4; ++rotation) {
+            tetris_orientation_t o;
+            int cells[16];
+
+            memset(&o, 0, sizeof o);
+            o.rotation = rotation;
+            shape_rotate(shape, rotation, cells, &o.w, &o.h);
+
+            int y;
+            for (y = 0; y < o.h; ++y) {
+                int x;
+                for (x = 0; x < o.w; ++x) {
+                    if (cells[y * o.w + x]) {
+                        o.rows[y] |= (uint16_t) (1u << x);
+                    }
+                }
+            }
+
+            /* Symmetric shapes repeat themselves; only keep the first of each. */
+            int i, duplicate = 0;
+            for (i = 0; i < entry->count; ++i) {
+                const tetris_orientation_t *other = &entry->orientations[i];
+                if (other->w == o.w && other->h == o.h && memcmp(other->rows, o.rows, sizeof o.rows) == 0) {
+                    duplicate = 1;
+                    break;
+                }
+            }
+
+            g_rotation_index[shape][rotation] = i;
+            if (!duplicate) {
+                entry->orientations[entry->count++] = o;
+            }
+        }
+    }
+
+    g_tables_ready = true;
+}
+
+const tetris_shape_orientations_t *bitboard_orientations(tetris_shape_kind_t shape) {
+    return &g_orientations[shape];
+}
+
+const tetris_orientation_t *bitboard_rotation(tetris_shape_kind_t shape, int rotation) {
+    return &g_orientations[shape].orientations[g_rotation_index[shape][rotation & 3]];
+}
+
+void bitboard_from_board(tetris_bitboard_t *bitboard, const tetris_board_t *board) {
+    int row;
+    for (row = 0; row < BITBOARD_ROWS; ++row) {
+        uint16_t bits = 0;
+
+        int col;
+        for (col = 0; col < BITBOARD_COLUMNS; ++col) {
+            if (board_get_cell(board, col + 1, row + 1) != g_tetris_colors[COLOR_NONE]) {
+                bits |= (uint16_t) (1u << col);
+            }
+        }
+
+        bitboard->rows[row] = bits;
+    }
+}
+
+bool bitboard_fits(const tetris_bitboard_t *board, const tetris_orientation_t *o, int col, int row) {
+    if (col < 0 || row < 0 || col + o->w > BITBOARD_COLUMNS || row + o->h > BITBOARD_ROWS) {
+        return false;
+    }
+
+    int y;
+    for (y = 0; y < o->h; ++y) {
+        if (board->rows[row + y] & (uint16_t) (o->rows[y] << col)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int bitboard_drop_row(const tetris_bitboard_t *board, const tetris_orientation_t *o, int col) {
+    if (!bitboard_fits(board, o, col, 0)) {
+        return -1;
+    }
+
+    int row = 0;
+    while (bitboard_fits(board, o, col, row + 1)) {
+        ++row;
+    }
+
+    return row;
+}
+
+int bitboard_clear_rows(tetris_bitboard_t *board) {
+    int read, write = BITBOARD_ROWS - 1;
+
+    for (read = BITBOARD_ROWS - 1; read >= 0; --read) {
+        if (board->rows[read] != BITBOARD_FULL_ROW) {
+            board->rows[write--] = board->rows[read];
+        }
+    }
+
+    const int cleared = write + 1;
+    for (; write >= 0; --write) {
+        board->rows[write] = 0;
+    }
+
+    return cleared;
+}
+
+int bitboard_place(tetris_bitboard_t *board, const tetris_orientation_t *o, int col, int row) {
+    int y, full = 0;
+    for (y = 0; y < o->h; ++y) {
+        board->rows[row + y] |= (uint16_t) (o->rows[y] << col);
+        full |= board->rows[row + y] == BITBOARD_FULL_ROW;
+    }
+
+    /* Only rows the piece touched can have become full. */
+    return full ? bitboard_clear_rows(board) : 0;
+}
+
+int bitboard_cell_count(const tetris_bitboard_t *board) {
+    int row, count = 0;
+    for (row = 0; row < BITBOARD_ROWS; ++row) {
+        uint16_t bits = board->rows[row];
+        for (; bits != 0; bits &= bits - 1) {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+int bitboard_height(const tetris_bitboard_t *board) {
+    int row;
+    for (row = 0; row < BITBOARD_ROWS; ++row) {
+        if (board->rows[row] != 0) {
+            return BITBOARD_ROWS - row;
+        }
+    }
+
+    return 0;
+}
+
+int bitboard_holes(const tetris_bitboard_t *board) {
+    uint16_t covered = 0;
+    int row, holes = 0;
+
+    for (row = 0; row < BITBOARD_ROWS; ++row) {
+        uint16_t empty_below = covered & (uint16_t) ~board->rows[row];
+        for (; empty_below != 0; empty_below &= empty_below - 1) {
+            ++holes;
+        }
+        covered |= board->rows[row];
+    }
+
+    return holes;
+}
+
+bool bitboard_is_empty(const tetris_bitboard_t *board) {
+    return bitboard_height(board) == 0;
+}
+
+uint64_t bitboard_hash(const tetris_bitboard_t *board) {
+    /* FNV-1a over the row words. */
+    uint64_t hash = 0xcbf29ce484222325ull;
+
+    int row;
+    for (row = 0; row < BITBOARD_ROWS; ++row) {
+        hash ^= board->rows[row];
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+tetris_placement_t bitboard_placement(tetris_shape_kind_t shape, const tetris_orientation_t *o, int col, int row) {
+    tetris_placement_t placement;
+
+    placement.shape = (uint8_t) shape;
+    placement.rotation = (uint8_t) o->rotation;
+    placement.x = (int8_t) (col + 1);
+    placement.y = (int8_t) (row + 1);
+
+    return placement;
+}
+
+int bitboard_enumerate(const tetris_bitboard_t *board, tetris_shape_kind_t shape,
+                       tetris_placement_t placements[BITBOARD_MAX_PLACEMENTS],
+                       const tetris_orientation_t *orientations[BITBOARD_MAX_PLACEMENTS]) {
+    const tetris_shape_orientations_t *entry = &g_orientations[shape];
+    int count = 0;
+
+    int i;
+    for (i = 0; i < entry->count; ++i) {
+        const tetris_orientation_t *o = &entry->orientations[i];
+
+        int col;
+        for (col = 0; col + o->w <= BITBOARD_COLUMNS; ++col) {
+            const int row = bitboard_drop_row(board, o, col);
+            if (row < 0) {
+                continue;
+            }
+
+            placements[count] = bitboard_placement(shape, o, col, row);
+            orientations[count] = o;
+            ++count;
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "engine.h"
+
+/**
+ * Compact board used by the headless tools (solver, bots, training
+ * environments). Only the playable area is stored: one bit per cell, one
+ * 16-bit word per row. Line clears follow board_check_for_clears.
+ */
+
+#define BITBOARD_COLUMNS (BOARD_COLUMNS - 2)
+#define BITBOARD_ROWS (BOARD_ROWS - 2)
+#define BITBOARD_FULL_ROW ((uint16_t) ((1u << BITBOARD_COLUMNS) - 1))
+#define BITBOARD_MAX_PLACEMENTS (4 * BITBOARD_COLUMNS)
+
+typedef struct {
+    uint16_t rows[BITBOARD_ROWS];	/* Row 0 is the top playable row, bit 0 the leftmost column. */
+} tetris_bitboard_t;
+
+typedef struct {
+    int rotation;		/* Clockwise quarter turns from the spawn orientation. */
+    int w, h;
+    uint16_t rows[4];	/* Bit 0 is the piece's leftmost column. */
+} tetris_orientation_t;
+
+typedef struct {
+    int count;			/* Distinct orientations; rotations that look the same are dropped. */
+    tetris_orientation_t orientations[4];
+} tetris_shape_orientations_t;
+
+/* A piece at rest, in the same coordinates as tetris_piece_t (margin included). */
+typedef struct {
+    uint8_t shape, rotation;
+    int8_t x, y;
+} tetris_placement_t;
+
+/* Must run once before any of the headless tools start their threads. */
+void bitboard_init_tables(void);
+
+const tetris_shape_orientations_t *bitboard_orientations(tetris_shape_kind_t shape);
+
+/* The orientation the shape has after the given number of quarter turns. */
+const tetris_orientation_t *bitboard_rotation(tetris_shape_kind_t shape, int rotation);
+
+/* The board must have the standard BOARD_ROWS height. */
+void bitboard_from_board(tetris_bitboard_t *bitboard, const tetris_board_t *board);
+
+bool bitboard_fits(const tetris_bitboard_t *board, const tetris_orientation_t *o, int col, int row);
+
+/* Row the piece comes to rest on when dropped from the top, or -1 if it does not fit there. */
+int bitboard_drop_row(const tetris_bitboard_t *board, const tetris_orientation_t *o, int col);
+
+/* Stamps the piece and clears full rows. Returns the number of rows cleared. */
+int bitboard_place(tetris_bitboard_t *board, const tetris_orientation_t *o, int col, int row);
+
+int bitboard_clear_rows(tetris_bitboard_t *board);
+
+int bitboard_cell_count(const tetris_bitboard_t *board);
+
+/* Number of rows from the floor up to the highest filled cell. */
+int bitboard_height(const tetris_bitboard_t *board);
+
+/* Empty cells with a filled cell somewhere above them in the same column. */
+int bitboard_holes(const tetris_bitboard_t *board);
+
+bool bitboard_is_empty(const tetris_bitboard_t *board);
+
+uint64_t bitboard_hash(const tetris_bitboard_t *board);
+
+tetris_placement_t bitboard_placement(tetris_shape_kind_t shape, const tetris_orientation_t *o, int col, int row);
+
+/* Every distinct hard-drop placement of the shape. Returns how many were written. */
+int bitboard_enumerate(const tetris_bitboard_t *board, tetris_shape_kind_t shape,
+                       tetris_placement_t placements[BITBOARD_MAX_PLACEMENTS],
+                       const tetris_orientation_t *orientations[BITBOARD_MAX_PLACEMENTS]);
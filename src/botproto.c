@@ -0,0 +1,497 @@
+#ifndef _WIN32
+# define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "botproto.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <SDL.h>
+
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <unistd.h>
+# include <poll.h>
+# include <signal.h>
+# include <sys/types.h>
+# include <sys/wait.h>
+#endif
+
+#define BOT_BUFFER_SIZE (4096)
+#define BOT_HEADER_SIZE (4)
+
+struct tetris_bot_link {
+#ifdef _WIN32
+    HANDLE process, to_bot, from_bot;
+#else
+    pid_t pid;
+    int to_bot, from_bot;
+#endif
+    bool binary;
+    int budget_ms;
+
+    char buffer[BOT_BUFFER_SIZE];
+    int buffered;
+
+    /* Latency statistics, in performance counter ticks. */
+    uint64_t requests, answered, timeouts;
+    uint64_t rejected;		/* Answered with a placement outside the board.	*/
+    uint64_t latency_total, latency_min, latency_max;
+};
+
+static void put_u16(uint8_t *p, uint16_t value) {
+    p[0] = value & 0xFF;
+    p[1] = (value >> 8) & 0xFF;
+}
+
+static void put_u32(uint8_t *p, uint32_t value) {
+    put_u16(p, value & 0xFFFF);
+    put_u16(p + 2, (value >> 16) & 0xFFFF);
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+#ifdef _WIN32
+
+static int bot_spawn(tetris_bot_link_t *link, const char *command) {
+    SECURITY_ATTRIBUTES inherit = {sizeof inherit, NULL, TRUE};
+    HANDLE child_in, child_out;
+
+    if (!CreatePipe(&child_in, &link->to_bot, &inherit, 0)) {
+        return 1;
+    }
+    if (!CreatePipe(&link->from_bot, &child_out, &inherit, 0)) {
+        CloseHandle(child_in);
+        CloseHandle(link->to_bot);
+        return 1;
+    }
+
+    SetHandleInformation(link->to_bot, HANDLE_FLAG_INHERIT, 0);
+    SetHandleInformation(link->from_bot, HANDLE_FLAG_INHERIT, 0);
+
+    STARTUPINFOA startup;
+    PROCESS_INFORMATION info;
+    memset(&startup, 0, sizeof startup);
+    startup.cb = sizeof startup;
+    startup.dwFlags = STARTF_USESTDHANDLES;
+    startup.hStdInput = child_in;
+    startup.hStdOutput = child_out;
+    startup.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+
+    char line[1024];
+    snprintf(line, sizeof line, "cmd.exe /c %s", command);
+
+    const BOOL started = CreateProcessA(NULL, line, NULL, NULL, TRUE, 0, NULL, NULL, &startup, &info);
+    CloseHandle(child_in);
+    CloseHandle(child_out);
+
+    if (!started) {
+        CloseHandle(link->to_bot);
+        CloseHandle(link->from_bot);
+        return 1;
+    }
+
+    CloseHandle(info.hThread);
+    link->process = info.hProcess;
+    return 0;
+}
+
+static int bot_write(tetris_bot_link_t *link, const void *data, int size) {
+    DWORD written;
+    return WriteFile(link->to_bot, data, size, &written, NULL) && (int) written == size ? 0 : 1;
+}
+
+/* Reads whatever is available, waiting at most timeout_ms. Returns -1 once the bot is gone. */
+static int bot_read(tetris_bot_link_t *link, int timeout_ms) {
+    const uint64_t deadline = SDL_GetTicks() + timeout_ms;
+
+    for (;;) {
+        DWORD available = 0;
+        if (!PeekNamedPipe(link->from_bot, NULL, 0, NULL, &available, NULL)) {
+            return -1;
+        }
+
+        if (available > 0) {
+            DWORD count;
+            const DWORD space = BOT_BUFFER_SIZE - link->buffered;
+            if (!ReadFile(link->from_bot, link->buffer + link->buffered, available < space ? available : space, &count, NULL)) {
+                return -1;
+            }
+            link->buffered += count;
+            return (int) count;
+        }
+
+        if (SDL_GetTicks() >= deadline) {
+            return 0;
+        }
+        Sleep(0);
+    }
+}
+
+static void bot_terminate(tetris_bot_link_t *link) {
+    CloseHandle(link->to_bot);
+    if (WaitForSingleObject(link->process, 1000) != WAIT_OBJECT_0) {
+        TerminateProcess(link->process, 1);
+    }
+    CloseHandle(link->from_bot);
+    CloseHandle(link->process);
+}
+
+#else
+
+static int bot_spawn(tetris_bot_link_t *link, const char *command) {
+    int to_bot[2], from_bot[2];
+
+    if (pipe(to_bot) != 0) {
+        return 1;
+    }
+    if (pipe(from_bot) != 0) {
+        close(to_bot[0]);
+        close(to_bot[1]);
+        return 1;
+    }
+
+    link->pid = fork();
+    if (link->pid < 0) {
+        close(to_bot[0]);
+        close(to_bot[1]);
+        close(from_bot[0]);
+        close(from_bot[1]);
+        return 1;
+    }
+
+    if (link->pid == 0) {
+        dup2(to_bot[0], STDIN_FILENO);
+        dup2(from_bot[1], STDOUT_FILENO);
+        close(to_bot[0]);
+        close(to_bot[1]);
+        close(from_bot[0]);
+        close(from_bot[1]);
+
+        execl("/bin/sh", "sh", "-c", command, (char *) NULL);
+        _exit(127);
+    }
+
+    close(to_bot[0]);
+    close(from_bot[1]);
+    link->to_bot = to_bot[1];
+    link->from_bot = from_bot[0];
+
+    /* A bot that exits mid-write must not take the game down with it. */
+    signal(SIGPIPE, SIG_IGN);
+
+    return 0;
+}
+
+static int bot_write(tetris_bot_link_t *link, const void *data, int size) {
+    const char *p = data;
+
+    while (size > 0) {
+        const ssize_t count = write(link->to_bot, p, size);
+        if (count <= 0) {
+            return 1;
+        }
+        p += count;
+        size -= (int) count;
+    }
+
+    return 0;
+}
+
+/* Reads whatever is available, waiting at most timeout_ms. Returns -1 once the bot is gone. */
+static int bot_read(tetris_bot_link_t *link, int timeout_ms) {
+    struct pollfd fd = {link->from_bot, POLLIN, 0};
+
+    const int ready = poll(&fd, 1, timeout_ms);
+    if (ready <= 0) {
+        return ready;
+    }
+
+    const ssize_t count = read(link->from_bot, link->buffer + link->buffered, BOT_BUFFER_SIZE - link->buffered);
+    if (count <= 0) {
+        return -1;
+    }
+
+    link->buffered += (int) count;
+    return (int) count;
+}
+
+static void bot_terminate(tetris_bot_link_t *link) {
+    close(link->to_bot);
+    close(link->from_bot);
+
+    /* Closing stdin is the signal to quit; give the bot a moment before killing it. */
+    int i, status;
+    for (i = 0; i < 100; ++i) {
+        if (waitpid(link->pid, &status, WNOHANG) == link->pid) {
+            return;
+        }
+        SDL_Delay(10);
+    }
+
+    kill(link->pid, SIGKILL);
+    waitpid(link->pid, &status, 0);
+}
+
+#endif
+
+static void bot_consume(tetris_bot_link_t *link, int size) {
+    memmove(link->buffer, link->buffer + size, link->buffered - size);
+    link->buffered -= size;
+}
+
+static int bot_send_frame(tetris_bot_link_t *link, bot_frame_type_t type, const uint8_t *payload, int size) {
+    uint8_t header[BOT_HEADER_SIZE] = {(uint8_t) type, 0};
+    put_u16(header + 2, (uint16_t) size);
+
+    return bot_write(link, header, sizeof header) || bot_write(link, payload, size);
+}
+
+tetris_bot_link_t *bot_link_open(const char *command, bool binary, int budget_ms) {
+    tetris_bot_link_t *link = calloc(1, sizeof(*link));
+    if (link == NULL)
+        return NULL;
+
+    link->binary = binary;
+    link->budget_ms = budget_ms > 0 ? budget_ms : BOT_BUDGET_DEFAULT_MS;
+    link->latency_min = UINT64_MAX;
+
+    if (bot_spawn(link, command) != 0) {
+        printf("Failed to start bot: %s\n", command);
+        free(link);
+        return NULL;
+    }
+
+    int status_code;
+    if (binary) {
+        const uint8_t hello[] = {BOT_PROTOCOL_VERSION, BITBOARD_COLUMNS, BITBOARD_ROWS};
+        status_code = bot_send_frame(link, BOT_FRAME_HELLO, hello, sizeof hello);
+    } else {
+        char line[64];
+        const int size = snprintf(line, sizeof line, "hello %d %d %d\n", BOT_PROTOCOL_VERSION, BITBOARD_COLUMNS, BITBOARD_ROWS);
+        status_code = bot_write(link, line, size);
+    }
+
+    if (status_code != 0) {
+        puts("Failed to talk to the bot");
+        bot_terminate(link);
+        free(link);
+        return NULL;
+    }
+
+    return link;
+}
+
+static int bot_send_state(tetris_bot_link_t *link, const bot_state_t *state) {
+    int i;
+
+    if (link->binary) {
+        uint8_t payload[9 + PIECE_QUEUE_SIZE + 2 * BITBOARD_ROWS];
+        int size = 0;
+
+        put_u32(payload, state->move_id);
+        payload[4] = (uint8_t) state->current;
+        payload[5] = (uint8_t) (int8_t) state->x;
+        payload[6] = (uint8_t) (int8_t) state->y;
+        payload[7] = (uint8_t) state->rotation;
+        payload[8] = (uint8_t) state->queue_length;
+        size = 9;
+
+        for (i = 0; i < state->queue_length; ++i) {
+            payload[size++] = (uint8_t) state->queue[i];
+        }
+        for (i = 0; i < BITBOARD_ROWS; ++i, size += 2) {
+            put_u16(payload + size, state->board.rows[i]);
+        }
+
+        return bot_send_frame(link, BOT_FRAME_STATE, payload, size);
+    }
+
+    char line[128 + BITBOARD_ROWS * (BITBOARD_COLUMNS + 1)];
+    char queue[PIECE_QUEUE_SIZE + 1];
+    int size;
+
+    for (i = 0; i < state->queue_length; ++i) {
+        queue[i] = shape_letter(state->queue[i]);
+    }
+    queue[i] = 0;
+
+    size = snprintf(line, sizeof line, "state %u %c %d %d %d %s ", state->move_id, shape_letter(state->current),
+                    state->x, state->y, state->rotation, state->queue_length > 0 ? queue : "-");
+
+    for (i = 0; i < BITBOARD_ROWS; ++i) {
+        int col;
+        for (col = 0; col < BITBOARD_COLUMNS; ++col) {
+            line[size++] = state->board.rows[i] & (1u << col) ? '#' : '.';
+        }
+        line[size++] = i + 1 < BITBOARD_ROWS ? '/' : '\n';
+    }
+
+    return bot_write(link, line, size);
+}
+
+/**
+ * Parses one complete message out of the buffer, if there is one.
+ * Returns 1 when a message for the given move was decoded, 0 otherwise.
+ */
+static int bot_parse(tetris_bot_link_t *link, uint32_t move_id, bot_reply_t *reply) {
+    while (link->buffered > 0) {
+        uint32_t id;
+        int size;
+
+        memset(reply, 0, sizeof(*reply));
+
+        if (link->binary) {
+            if (link->buffered < BOT_HEADER_SIZE) {
+                return 0;
+            }
+
+            const uint8_t *frame = (const uint8_t *) link->buffer;
+            const int length = frame[2] | (frame[3] << 8);
+            const uint8_t *payload = frame + BOT_HEADER_SIZE;
+
+            size = BOT_HEADER_SIZE + length;
+            if (size > BOT_BUFFER_SIZE) {
+                /* Nothing sane is this long; drop what we have and resync on the next request. */
+                link->buffered = 0;
+                return 0;
+            }
+            if (link->buffered < size || length < 4) {
+                if (link->buffered >= size) {
+                    bot_consume(link, size);
+                    continue;
+                }
+                return 0;
+            }
+
+            id = get_u32(payload);
+
+            if (frame[0] == BOT_FRAME_PLACE && length >= 6) {
+                reply->kind = BOT_REPLY_PLACE;
+                reply->rotation = payload[4];
+                reply->x = (int8_t) payload[5];
+            } else if (frame[0] == BOT_FRAME_KEYS && length >= 5) {
+                int count = payload[4];
+                if (count > BOT_MAX_KEYS) count = BOT_MAX_KEYS;
+                if (count > length - 5) count = length - 5;
+
+                reply->kind = BOT_REPLY_KEYS;
+                memcpy(reply->keys, payload + 5, count);
+                reply->keys[count] = 0;
+            }
+        } else {
+            char *end = memchr(link->buffer, '\n', link->buffered);
+            if (end == NULL) {
+                if (link->buffered == BOT_BUFFER_SIZE) {
+                    link->buffered = 0;
+                }
+                return 0;
+            }
+
+            *end = 0;
+            size = (int) (end - link->buffer) + 1;
+
+            char keys[BOT_MAX_KEYS + 1];
+            int rotation, x;
+
+            if (sscanf(link->buffer, "place %u %d %d", &id, &rotation, &x) == 3) {
+                reply->kind = BOT_REPLY_PLACE;
+                reply->rotation = rotation;
+                reply->x = x;
+            } else if (sscanf(link->buffer, "keys %u %32s", &id, keys) == 2) {
+                reply->kind = BOT_REPLY_KEYS;
+                strcpy(reply->keys, keys);
+            } else if (sscanf(link->buffer, "pass %u", &id) != 1) {
+                fprintf(stderr, "Ignoring bot message: %s\n", link->buffer);
+                bot_consume(link, size);
+                continue;
+            }
+        }
+
+        bot_consume(link, size);
+
+        /* Late answers to earlier moves are dropped. */
+        if (id != move_id) {
+            continue;
+        }
+
+        /* Every key of a placement is queued at once; keep it within the board. */
+        if (reply->kind == BOT_REPLY_PLACE
+            && (reply->rotation < 0 || reply->rotation > 3 || reply->x < 1 || reply->x > BOARD_COLUMNS - 2)) {
+            fprintf(stderr, "Ignoring bot placement off the board: rotation %d, x %d\n", reply->rotation, reply->x);
+            link->rejected += 1;
+            reply->kind = BOT_REPLY_NONE;
+        }
+
+        return 1;
+    }
+
+    return 0;
+}
+
+int bot_link_request(tetris_bot_link_t *link, const bot_state_t *state, bot_reply_t *reply) {
+    memset(reply, 0, sizeof(*reply));
+
+    if (bot_send_state(link, state) != 0) {
+        puts("The bot stopped reading its input");
+        return 1;
+    }
+
+    const uint64_t frequency = SDL_GetPerformanceFrequency();
+    const uint64_t begin = SDL_GetPerformanceCounter();
+    const uint64_t budget = frequency * link->budget_ms / 1000;
+
+    link->requests += 1;
+
+    for (;;) {
+        if (bot_parse(link, state->move_id, reply)) {
+            const uint64_t latency = SDL_GetPerformanceCounter() - begin;
+
+            link->answered += 1;
+            link->latency_total += latency;
+            if (latency < link->latency_min) link->latency_min = latency;
+            if (latency > link->latency_max) link->latency_max = latency;
+
+            return 0;
+        }
+
+        const uint64_t elapsed = SDL_GetPerformanceCounter() - begin;
+        if (elapsed >= budget) {
+            link->timeouts += 1;
+            reply->kind = BOT_REPLY_NONE;
+            return 0;
+        }
+
+        const int remaining_ms = (int) ((budget - elapsed) * 1000 / frequency) + 1;
+        if (bot_read(link, remaining_ms) < 0) {
+            puts("The bot closed its output");
+            return 1;
+        }
+    }
+}
+
+void bot_link_close(tetris_bot_link_t *link) {
+    if (link == NULL) {
+        return;
+    }
+
+    const double to_ms = 1000.0 / (double) SDL_GetPerformanceFrequency();
+
+    printf("Bot: %llu moves requested, %llu answered, %llu over the %d ms budget, %llu bad placements\n",
+           (unsigned long long) link->requests, (unsigned long long) link->answered,
+           (unsigned long long) link->timeouts, link->budget_ms, (unsigned long long) link->rejected);
+
+    if (link->answered > 0) {
+        printf("Bot latency: min %.3f ms, avg %.3f ms, max %.3f ms\n",
+               link->latency_min * to_ms, (double) link->latency_total / (double) link->answered * to_ms,
+               link->latency_max * to_ms);
+    }
+
+    bot_terminate(link);
+    free(link);
+}
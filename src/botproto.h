@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "bitboard.h"
+
+/**
+ * Protocol for driving the game from an external bot process.
+ *
+ * The bot is started through the shell and talks over its stdin/stdout.
+ * Every time a piece spawns the engine sends the board, the current piece and
+ * the queue, then waits up to the move budget for an answer. Answers that
+ * arrive late are matched by move id and dropped.
+ *
+ * Text mode, one message per line:
+ *   engine: hello <version> <columns> <rows>
+ *   engine: state <id> <piece> <x> <y> <rotation> <queue> <rows>
+ *           rows are '.'/'#' strings joined by '/', top row first
+ *   bot:    place <id> <rotation> <x>
+ *   bot:    keys <id> <sequence>     L left, R right, D down, C rotate
+ *   bot:    pass <id>
+ *
+ * Binary mode, frames of a 4 byte header (type, flags, little endian
+ * payload length) followed by the payload:
+ *   HELLO  u8 version, u8 columns, u8 rows
+ *   STATE  u32 id, u8 piece, i8 x, i8 y, u8 rotation, u8 queue length,
+ *          queue bytes, then one u16 per row, top row first
+ *   PLACE  u32 id, u8 rotation, i8 x
+ *   KEYS   u32 id, u8 count, count key bytes
+ *   PASS   u32 id
+ *
+ * Pieces are numbered as tetris_shape_kind_t (letters JLIOSTZ in text mode),
+ * positions use the same board coordinates as tetris_piece_t. A placement
+ * with a rotation outside 0-3 or an x outside the playfield columns is
+ * counted as a bad reply and the piece falls on its own.
+ */
+
+#define BOT_PROTOCOL_VERSION (1)
+#define BOT_MAX_KEYS (32)
+
+typedef enum {
+    BOT_FRAME_HELLO = 1,
+    BOT_FRAME_STATE,
+    BOT_FRAME_PLACE,
+    BOT_FRAME_KEYS,
+    BOT_FRAME_PASS
+} bot_frame_type_t;
+
+typedef enum {
+    BOT_REPLY_NONE,		/* Timed out or passed: the piece keeps falling on its own. */
+    BOT_REPLY_PLACE,
+    BOT_REPLY_KEYS
+} bot_reply_kind_t;
+
+typedef struct {
+    bot_reply_kind_t kind;
+    int rotation, x;
+    char keys[BOT_MAX_KEYS + 1];
+} bot_reply_t;
+
+typedef struct {
+    uint32_t move_id;
+    tetris_bitboard_t board;
+    tetris_shape_kind_t current;
+    int x, y, rotation;
+    tetris_shape_kind_t queue[PIECE_QUEUE_SIZE];
+    int queue_length;
+} bot_state_t;
+
+tetris_bot_link_t *bot_link_open(const char *command, bool binary, int budget_ms);
+
+/* Returns nonzero once the bot has gone away; a timeout is a BOT_REPLY_NONE reply. */
+int bot_link_request(tetris_bot_link_t *link, const bot_state_t *state, bot_reply_t *reply);
+
+/* Prints the latency summary and stops the bot. */
+void bot_link_close(tetris_bot_link_t *link);
@@ -0,0 +1,677 @@
+#ifndef _WIN32
+# define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "dataset.h"
+#include "beambot.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL.h>
+
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+#endif
+
+#define DATASET_SAMPLES_DEFAULT (100000)
+#define DATASET_GAME_PIECES_MAX (5000)	/* Strong bots rarely top out; start over now and then for variety. */
+#define RLE_MIN_RUN (3)
+#define RLE_MAX_RUN (RLE_MIN_RUN + 127)
+#define RLE_MAX_LITERAL (128)
+
+static const int g_column_sizes[DATASET_COLUMN_COUNT] = {
+    sizeof(uint16_t) * BITBOARD_ROWS,
+    1 + PIECE_QUEUE_SIZE,
+    sizeof(uint8_t),
+    sizeof(uint8_t),
+    sizeof(uint32_t),
+};
+
+static uint32_t g_crc_table[256];
+
+static void dataset_init_crc(void) {
+    if (g_crc_table[1] != 0) {
+        return;
+    }
+
+    uint32_t i;
+    for (i = 0; i < 256; ++i) {
+        uint32_t c = i;
+        int k;
+        for (k = 0; k < 8; ++k) {
+            c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        g_crc_table[i] = c;
+    }
+}
+
+static uint32_t dataset_crc(const uint8_t *data, size_t size) {
+    uint32_t crc = 0xFFFFFFFFu;
+
+    size_t i;
+    for (i = 0; i < size; ++i) {
+        crc = g_crc_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+
+    return crc ^ 0xFFFFFFFFu;
+}
+
+/* Worst case output of rle_encode: every byte a literal. */
+static size_t rle_bound(size_t size) {
+    return size + size / RLE_MAX_LITERAL + 1;
+}
+
+/**
+ * PackBits style: a control byte below 0x80 is followed by control + 1
+ * literal bytes, one from 0x80 up repeats the next byte control - 0x80 + 3
+ * times. Board rows are mostly zero words, which collapse into long runs.
+ */
+static size_t rle_encode(const uint8_t *src, size_t size, uint8_t *dst) {
+    size_t in = 0, out = 0;
+
+    while (in < size) {
+        size_t run = 1;
+        while (in + run < size && run < RLE_MAX_RUN && src[in + run] == src[in]) {
+            ++run;
+        }
+
+        if (run >= RLE_MIN_RUN) {
+            dst[out++] = (uint8_t) (0x80 | (run - RLE_MIN_RUN));
+            dst[out++] = src[in];
+            in += run;
+            continue;
+        }
+
+        /* Literals up to the next run worth encoding. */
+        const size_t start = in;
+        while (in < size && in - start < RLE_MAX_LITERAL) {
+            if (in + 2 < size && src[in] == src[in + 1] && src[in] == src[in + 2]) {
+                break;
+            }
+            ++in;
+        }
+
+        dst[out++] = (uint8_t) (in - start - 1);
+        memcpy(dst + out, src + start, in - start);
+        out += in - start;
+    }
+
+    return out;
+}
+
+/* Returns the decoded size, or -1 when the input is malformed or does not fit. */
+static long rle_decode(const uint8_t *src, size_t size, uint8_t *dst, size_t capacity) {
+    size_t in = 0, out = 0;
+
+    while (in < size) {
+        const uint8_t control = src[in++];
+
+        if (control & 0x80) {
+            const size_t run = (control & 0x7F) + RLE_MIN_RUN;
+            if (in >= size || out + run > capacity) {
+                return -1;
+            }
+            memset(dst + out, src[in++], run);
+            out += run;
+        } else {
+            const size_t length = control + 1u;
+            if (in + length > size || out + length > capacity) {
+                return -1;
+            }
+            memcpy(dst + out, src + in, length);
+            in += length;
+            out += length;
+        }
+    }
+
+    return (long) out;
+}
+
+static size_t dataset_padded(size_t size) {
+    return (size + DATASET_ALIGNMENT - 1) / DATASET_ALIGNMENT * DATASET_ALIGNMENT;
+}
+
+/*
+ *****************************
+ * Writer
+ *****************************
+ */
+
+typedef struct {
+    uint8_t *columns[DATASET_COLUMN_COUNT];
+    int count;
+    bool pending;			/* Handed to the writer thread and not written yet. */
+} dataset_buffer_t;
+
+struct tetris_dataset_writer {
+    FILE *file;
+    SDL_Thread *thread;
+    SDL_mutex *lock;
+    SDL_cond *changed;
+    bool quit;
+    int failed;
+
+    dataset_buffer_t buffers[2];
+    int filling;			/* Buffer the producer appends to. */
+
+    /* Writer thread only. */
+    uint8_t *scratch[DATASET_COLUMN_COUNT];
+    uint64_t records, raw_bytes, stored_bytes, chunks;
+
+    uint64_t blocked_ticks;	/* Producer time spent waiting for the writer. */
+};
+
+static int dataset_write_chunk(tetris_dataset_writer_t *writer, const dataset_buffer_t *buffer) {
+    tetris_dataset_chunk_header_t header;
+    const uint8_t *payloads[DATASET_COLUMN_COUNT];
+    static const uint8_t padding[DATASET_ALIGNMENT] = {0};
+
+    memset(&header, 0, sizeof header);
+    memcpy(header.magic, DATASET_CHUNK_MAGIC, sizeof header.magic);
+    header.record_count = (uint32_t) buffer->count;
+
+    int c;
+    for (c = 0; c < DATASET_COLUMN_COUNT; ++c) {
+        tetris_dataset_column_header_t *column = &header.columns[c];
+        const size_t raw = (size_t) buffer->count * g_column_sizes[c];
+        const size_t packed = rle_encode(buffer->columns[c], raw, writer->scratch[c]);
+
+        column->raw_size = (uint32_t) raw;
+
+        /* Keep the raw bytes unless compression pays; they can then be read in place. */
+        if (packed < raw) {
+            column->codec = DATASET_CODEC_RLE;
+            column->stored_size = (uint32_t) packed;
+            payloads[c] = writer->scratch[c];
+        } else {
+            column->codec = DATASET_CODEC_STORED;
+            column->stored_size = (uint32_t) raw;
+            payloads[c] = buffer->columns[c];
+        }
+
+        column->crc = dataset_crc(payloads[c], column->stored_size);
+
+        writer->raw_bytes += raw;
+        writer->stored_bytes += column->stored_size;
+    }
+
+    if (fwrite(&header, sizeof header, 1, writer->file) != 1) {
+        return 1;
+    }
+
+    for (c = 0; c < DATASET_COLUMN_COUNT; ++c) {
+        const size_t stored = header.columns[c].stored_size;
+        const size_t pad = dataset_padded(stored) - stored;
+
+        if (fwrite(payloads[c], 1, stored, writer->file) != stored || fwrite(padding, 1, pad, writer->file) != pad) {
+            return 1;
+        }
+    }
+
+    writer->records += buffer->count;
+    writer->chunks += 1;
+
+    return 0;
+}
+
+static int dataset_writer_main(void *data) {
+    tetris_dataset_writer_t *writer = data;
+    int next = 0;
+
+    SDL_LockMutex(writer->lock);
+    for (;;) {
+        while (!writer->buffers[next].pending && !writer->quit) {
+            SDL_CondWait(writer->changed, writer->lock);
+        }
+
+        if (!writer->buffers[next].pending) {
+            break;
+        }
+
+        SDL_UnlockMutex(writer->lock);
+        const int failed = writer->failed || dataset_write_chunk(writer, &writer->buffers[next]);
+        SDL_LockMutex(writer->lock);
+
+        if (failed && !writer->failed) {
+            puts("Failed to write dataset chunk");
+        }
+        writer->failed |= failed;
+        writer->buffers[next].pending = false;
+        writer->buffers[next].count = 0;
+        SDL_CondBroadcast(writer->changed);
+
+        next ^= 1;
+    }
+    SDL_UnlockMutex(writer->lock);
+
+    return 0;
+}
+
+static void dataset_writer_free(tetris_dataset_writer_t *writer) {
+    int b, c;
+    for (b = 0; b < 2; ++b) {
+        for (c = 0; c < DATASET_COLUMN_COUNT; ++c) {
+            free(writer->buffers[b].columns[c]);
+        }
+    }
+    for (c = 0; c < DATASET_COLUMN_COUNT; ++c) {
+        free(writer->scratch[c]);
+    }
+
+    if (writer->changed != NULL) SDL_DestroyCond(writer->changed);
+    if (writer->lock != NULL) SDL_DestroyMutex(writer->lock);
+    if (writer->file != NULL) fclose(writer->file);
+
+    free(writer);
+}
+
+tetris_dataset_writer_t *dataset_writer_open(const char *path) {
+    tetris_dataset_writer_t *writer = calloc(1, sizeof(*writer));
+    if (writer == NULL)
+        return NULL;
+
+    dataset_init_crc();
+
+    int ok = 1, b, c;
+    for (c = 0; c < DATASET_COLUMN_COUNT; ++c) {
+        const size_t raw = (size_t) DATASET_CHUNK_RECORDS * g_column_sizes[c];
+
+        for (b = 0; b < 2; ++b) {
+            ok &= (writer->buffers[b].columns[c] = malloc(raw)) != NULL;
+        }
+        ok &= (writer->scratch[c] = malloc(rle_bound(raw))) != NULL;
+    }
+
+    writer->lock = SDL_CreateMutex();
+    writer->changed = SDL_CreateCond();
+    writer->file = fopen(path, "wb");
+
+    if (!ok || writer->lock == NULL || writer->changed == NULL) {
+        puts("Failed to allocate the dataset writer");
+        dataset_writer_free(writer);
+        return NULL;
+    }
+
+    if (writer->file == NULL) {
+        printf("Failed to open %s\n", path);
+        dataset_writer_free(writer);
+        return NULL;
+    }
+
+    tetris_dataset_header_t header;
+    memcpy(header.magic, DATASET_MAGIC, sizeof header.magic);
+    header.version = DATASET_VERSION;
+    header.column_count = DATASET_COLUMN_COUNT;
+
+    if (fwrite(&header, sizeof header, 1, writer->file) != 1) {
+        printf("Failed to write %s\n", path);
+        dataset_writer_free(writer);
+        return NULL;
+    }
+
+    writer->thread = SDL_CreateThread(dataset_writer_main, "dataset", writer);
+    if (writer->thread == NULL) {
+        puts("Failed to start the dataset writer thread");
+        dataset_writer_free(writer);
+        return NULL;
+    }
+
+    return writer;
+}
+
+/* Hands the filled buffer to the writer thread and switches to the other one. */
+static void dataset_writer_submit(tetris_dataset_writer_t *writer) {
+    dataset_buffer_t *current = &writer->buffers[writer->filling];
+    dataset_buffer_t *other = &writer->buffers[writer->filling ^ 1];
+
+    SDL_LockMutex(writer->lock);
+    current->pending = true;
+    SDL_CondBroadcast(writer->changed);
+
+    if (other->pending) {
+        const uint64_t begin = SDL_GetPerformanceCounter();
+        while (other->pending) {
+            SDL_CondWait(writer->changed, writer->lock);
+        }
+        writer->blocked_ticks += SDL_GetPerformanceCounter() - begin;
+    }
+    SDL_UnlockMutex(writer->lock);
+
+    writer->filling ^= 1;
+}
+
+void dataset_writer_append(tetris_dataset_writer_t *writer, const tetris_bitboard_t *board, const uint8_t *pieces,
+                           uint8_t action, uint8_t lines, uint32_t score) {
+    dataset_buffer_t *buffer = &writer->buffers[writer->filling];
+    const int i = buffer->count;
+
+    memcpy(buffer->columns[DATASET_COLUMN_ROWS] + (size_t) i * g_column_sizes[DATASET_COLUMN_ROWS], board->rows, sizeof board->rows);
+    memcpy(buffer->columns[DATASET_COLUMN_PIECES] + (size_t) i * g_column_sizes[DATASET_COLUMN_PIECES], pieces, 1 + PIECE_QUEUE_SIZE);
+    buffer->columns[DATASET_COLUMN_ACTION][i] = action;
+    buffer->columns[DATASET_COLUMN_LINES][i] = lines;
+    memcpy(buffer->columns[DATASET_COLUMN_SCORE] + (size_t) i * sizeof score, &score, sizeof score);
+
+    if (++buffer->count == DATASET_CHUNK_RECORDS) {
+        dataset_writer_submit(writer);
+    }
+}
+
+int dataset_writer_close(tetris_dataset_writer_t *writer) {
+    if (writer->buffers[writer->filling].count > 0) {
+        dataset_writer_submit(writer);
+    }
+
+    SDL_LockMutex(writer->lock);
+    writer->quit = true;
+    SDL_CondBroadcast(writer->changed);
+    SDL_UnlockMutex(writer->lock);
+
+    SDL_WaitThread(writer->thread, NULL);
+
+    const int status_code = writer->failed || fflush(writer->file) != 0;
+
+    printf("Dataset: %llu samples in %llu chunks, %.1f MB stored from %.1f MB (%.1f%%), producer waited %.3f s on the writer\n",
+           (unsigned long long) writer->records, (unsigned long long) writer->chunks,
+           writer->stored_bytes / 1e6, writer->raw_bytes / 1e6,
+           writer->raw_bytes > 0 ? 100.0 * writer->stored_bytes / writer->raw_bytes : 0.0,
+           (double) writer->blocked_ticks / (double) SDL_GetPerformanceFrequency());
+
+    dataset_writer_free(writer);
+
+    return status_code;
+}
+
+/*
+ *****************************
+ * Reader
+ *****************************
+ */
+
+struct tetris_dataset_reader {
+    const uint8_t *base;
+    size_t size, offset;
+
+    /* Decompressed columns, reused from chunk to chunk. */
+    uint8_t *decoded[DATASET_COLUMN_COUNT];
+    size_t decoded_capacity[DATASET_COLUMN_COUNT];
+
+#ifdef _WIN32
+    HANDLE file, mapping;
+#endif
+};
+
+tetris_dataset_reader_t *dataset_reader_open(const char *path) {
+    tetris_dataset_reader_t *reader = calloc(1, sizeof(*reader));
+    if (reader == NULL)
+        return NULL;
+
+    dataset_init_crc();
+
+#ifdef _WIN32
+    reader->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    LARGE_INTEGER size;
+    if (reader->file == INVALID_HANDLE_VALUE || !GetFileSizeEx(reader->file, &size)) {
+        printf("Failed to open %s\n", path);
+        if (reader->file != INVALID_HANDLE_VALUE) CloseHandle(reader->file);
+        free(reader);
+        return NULL;
+    }
+
+    reader->size = (size_t) size.QuadPart;
+    reader->mapping = reader->size > 0 ? CreateFileMappingA(reader->file, NULL, PAGE_READONLY, 0, 0, NULL) : NULL;
+    reader->base = reader->mapping != NULL ? MapViewOfFile(reader->mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+#else
+    const int fd = open(path, O_RDONLY);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0) {
+        printf("Failed to open %s\n", path);
+        if (fd >= 0) close(fd);
+        free(reader);
+        return NULL;
+    }
+
+    reader->size = (size_t) info.st_size;
+    if (reader->size > 0) {
+        void *map = mmap(NULL, reader->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        reader->base = map != MAP_FAILED ? map : NULL;
+    }
+    close(fd);
+#endif
+
+    const tetris_dataset_header_t *header = (const tetris_dataset_header_t *) reader->base;
+
+    if (reader->base == NULL || reader->size < sizeof(*header) || memcmp(header->magic, DATASET_MAGIC, sizeof header->magic) != 0
+        || header->version != DATASET_VERSION || header->column_count != DATASET_COLUMN_COUNT) {
+        printf("%s is not a dataset file\n", path);
+        dataset_reader_close(reader);
+        return NULL;
+    }
+
+    reader->offset = sizeof(*header);
+
+    return reader;
+}
+
+int dataset_reader_next(tetris_dataset_reader_t *reader, tetris_dataset_chunk_t *chunk) {
+    if (reader->offset == reader->size) {
+        return 0;
+    }
+
+    const tetris_dataset_chunk_header_t *header = (const tetris_dataset_chunk_header_t *) (reader->base + reader->offset);
+    if (reader->size - reader->offset < sizeof(*header) || memcmp(header->magic, DATASET_CHUNK_MAGIC, sizeof header->magic) != 0
+        || header->record_count == 0 || header->record_count > DATASET_CHUNK_RECORDS) {
+        printf("Damaged dataset chunk at offset %zu\n", reader->offset);
+        return -1;
+    }
+
+    const uint8_t *columns[DATASET_COLUMN_COUNT];
+    size_t offset = reader->offset + sizeof(*header);
+
+    int c;
+    for (c = 0; c < DATASET_COLUMN_COUNT; ++c) {
+        const tetris_dataset_column_header_t *column = &header->columns[c];
+        const size_t raw = (size_t) header->record_count * g_column_sizes[c];
+        const uint8_t *stored = reader->base + offset;
+
+        /* offset never passes the end of the mapping, so this cannot wrap. */
+        if (reader->size - offset < dataset_padded(column->stored_size)) {
+            printf("Truncated dataset chunk at offset %zu\n", reader->offset);
+            return -1;
+        }
+
+        if (column->raw_size != raw || dataset_crc(stored, column->stored_size) != column->crc) {
+            printf("Damaged dataset column %d in the chunk at offset %zu\n", c, reader->offset);
+            return -1;
+        }
+
+        if (column->codec == DATASET_CODEC_STORED && column->stored_size == raw) {
+            columns[c] = stored;
+        } else if (column->codec == DATASET_CODEC_RLE) {
+            if (reader->decoded_capacity[c] < raw) {
+                uint8_t *grown = realloc(reader->decoded[c], raw);
+                if (grown == NULL) {
+                    puts("Failed to allocate a dataset column");
+                    return -1;
+                }
+                reader->decoded[c] = grown;
+                reader->decoded_capacity[c] = raw;
+            }
+
+            if (rle_decode(stored, column->stored_size, reader->decoded[c], raw) != (long) raw) {
+                printf("Damaged dataset column %d in the chunk at offset %zu\n", c, reader->offset);
+                return -1;
+            }
+            columns[c] = reader->decoded[c];
+        } else {
+            printf("Unknown codec in the dataset chunk at offset %zu\n", reader->offset);
+            return -1;
+        }
+
+        offset += dataset_padded(column->stored_size);
+    }
+
+    chunk->count = (int) header->record_count;
+    chunk->boards = (const tetris_bitboard_t *) columns[DATASET_COLUMN_ROWS];
+    chunk->pieces = columns[DATASET_COLUMN_PIECES];
+    chunk->actions = columns[DATASET_COLUMN_ACTION];
+    chunk->lines = columns[DATASET_COLUMN_LINES];
+    chunk->scores = (const uint32_t *) columns[DATASET_COLUMN_SCORE];
+
+    reader->offset = offset;
+
+    return 1;
+}
+
+void dataset_reader_close(tetris_dataset_reader_t *reader) {
+    if (reader == NULL) {
+        return;
+    }
+
+#ifdef _WIN32
+    if (reader->base != NULL) UnmapViewOfFile(reader->base);
+    if (reader->mapping != NULL) CloseHandle(reader->mapping);
+    CloseHandle(reader->file);
+#else
+    if (reader->base != NULL) munmap((void *) reader->base, reader->size);
+#endif
+
+    int c;
+    for (c = 0; c < DATASET_COLUMN_COUNT; ++c) {
+        free(reader->decoded[c]);
+    }
+
+    free(reader);
+}
+
+/*
+ *****************************
+ * Command line
+ *****************************
+ */
+
+static void dataset_new_game(tetris_bitboard_t *board, uint8_t *pieces, unsigned int *score) {
+    memset(board, 0, sizeof(*board));
+    *score = 0;
+
+    int i;
+    for (i = 0; i <= PIECE_QUEUE_SIZE; ++i) {
+        pieces[i] = (uint8_t) (rand() % SHAPE_END);
+    }
+}
+
+int dataset_export(const tetris_options_t *options) {
+    const int samples = options->dataset_samples > 0 ? options->dataset_samples : DATASET_SAMPLES_DEFAULT;
+
+    tetris_beambot_t *bot = beambot_create(options->beam_width, options->beam_lookahead, options->threads);
+    if (bot == NULL) {
+        return 1;
+    }
+
+    tetris_dataset_writer_t *writer = dataset_writer_open(options->dataset_output);
+    if (writer == NULL) {
+        beambot_destroy(bot);
+        return 1;
+    }
+
+    srand((unsigned int) SDL_GetPerformanceCounter());
+
+    tetris_bitboard_t board;
+    uint8_t pieces[1 + PIECE_QUEUE_SIZE];
+    tetris_shape_kind_t queue[1 + PIECE_QUEUE_SIZE];
+    unsigned int score;
+    int game_pieces = 0, games = 1;
+
+    dataset_new_game(&board, pieces, &score);
+
+    const uint64_t begin = SDL_GetPerformanceCounter();
+
+    int i;
+    for (i = 0; i < samples; ++i) {
+        int k;
+        for (k = 0; k <= PIECE_QUEUE_SIZE; ++k) {
+            queue[k] = pieces[k];
+        }
+
+        tetris_placement_t placement;
+        if (!beambot_search(bot, &board, queue, 1 + PIECE_QUEUE_SIZE, UINT64_MAX, &placement)) {
+            dataset_new_game(&board, pieces, &score);
+            game_pieces = 0;
+            ++games;
+            --i;
+            continue;
+        }
+
+        const tetris_orientation_t *o = bitboard_rotation(placement.shape, placement.rotation);
+        const tetris_bitboard_t before = board;
+        const int lines = bitboard_place(&board, o, placement.x - 1, placement.y - 1);
+        const unsigned int points = score_for_clears(score, lines);
+
+        dataset_writer_append(writer, &before, pieces, (uint8_t) (placement.rotation * BITBOARD_COLUMNS + placement.x - 1),
+                              (uint8_t) lines, points);
+        score += points;
+
+        memmove(pieces, pieces + 1, PIECE_QUEUE_SIZE);
+        pieces[PIECE_QUEUE_SIZE] = (uint8_t) (rand() % SHAPE_END);
+
+        /* The game's loss rule: the next piece overlaps the stack where it spawns. */
+        if (++game_pieces >= DATASET_GAME_PIECES_MAX
+            || !bitboard_fits(&board, bitboard_rotation(pieces[0], 0), PIECE_SPAWN_X - 1, PIECE_SPAWN_Y - 1)) {
+            dataset_new_game(&board, pieces, &score);
+            game_pieces = 0;
+            ++games;
+        }
+    }
+
+    const double seconds = (double) (SDL_GetPerformanceCounter() - begin) / (double) SDL_GetPerformanceFrequency();
+    printf("Played %d samples over %d games in %.2fs (%.0f samples/s)\n", samples, games, seconds, samples / seconds);
+
+    beambot_destroy(bot);
+    return dataset_writer_close(writer);
+}
+
+int dataset_summary(const char *path) {
+    tetris_dataset_reader_t *reader = dataset_reader_open(path);
+    if (reader == NULL) {
+        return 1;
+    }
+
+    const uint64_t begin = SDL_GetPerformanceCounter();
+    uint64_t records = 0, lines = 0, points = 0, chunks = 0, cells = 0;
+    uint64_t lines_histogram[5] = {0};
+    tetris_dataset_chunk_t chunk;
+    int status_code;
+
+    while ((status_code = dataset_reader_next(reader, &chunk)) == 1) {
+        int i;
+        for (i = 0; i < chunk.count; ++i) {
+            lines += chunk.lines[i];
+            points += chunk.scores[i];
+            lines_histogram[chunk.lines[i] < 4 ? chunk.lines[i] : 4] += 1;
+            cells += bitboard_cell_count(&chunk.boards[i]);
+        }
+
+        records += chunk.count;
+        chunks += 1;
+    }
+
+    const double seconds = (double) (SDL_GetPerformanceCounter() - begin) / (double) SDL_GetPerformanceFrequency();
+
+    printf("%llu samples in %llu chunks, read and verified in %.3fs\n",
+           (unsigned long long) records, (unsigned long long) chunks, seconds);
+    printf("Lines cleared: %llu (singles %llu, doubles %llu, triples %llu, tetrises %llu), points %llu\n",
+           (unsigned long long) lines, (unsigned long long) lines_histogram[1], (unsigned long long) lines_histogram[2],
+           (unsigned long long) lines_histogram[3], (unsigned long long) lines_histogram[4], (unsigned long long) points);
+    if (records > 0) {
+        printf("Average filled cells per board: %.1f\n", (double) cells / (double) records);
+    }
+
+    dataset_reader_close(reader);
+
+    return status_code < 0;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "bitboard.h"
+
+/**
+ * Training dataset of decision points: the board and pieces a player saw,
+ * the placement chosen and what it earned.
+ *
+ * Samples are stored in chunks, column by column, so each field of a chunk
+ * is one contiguous array. Every column is run-length compressed when that
+ * makes it smaller and carries a CRC-32 of its stored bytes. A writer thread
+ * compresses and writes one chunk while the producer fills the other.
+ *
+ * File layout: a tetris_dataset_header_t, then chunks. Each chunk is a
+ * tetris_dataset_chunk_header_t followed by its column payloads, each padded
+ * to DATASET_ALIGNMENT bytes. Everything is in host byte order, like the
+ * telemetry log.
+ */
+
+#define DATASET_MAGIC "TDSF"
+#define DATASET_CHUNK_MAGIC "TDSC"
+#define DATASET_VERSION (1)
+#define DATASET_CHUNK_RECORDS (16384)
+#define DATASET_ALIGNMENT (8)
+
+typedef enum {
+    DATASET_COLUMN_ROWS,		/* BITBOARD_ROWS uint16_t per sample, as tetris_bitboard_t.		*/
+    DATASET_COLUMN_PIECES,		/* 1 + PIECE_QUEUE_SIZE uint8_t: current piece, then the queue.	*/
+    DATASET_COLUMN_ACTION,		/* uint8_t, rotation * BITBOARD_COLUMNS + column, as vecenv.	*/
+    DATASET_COLUMN_LINES,		/* uint8_t rows cleared by the placement.						*/
+    DATASET_COLUMN_SCORE,		/* uint32_t score gained by the placement.						*/
+    DATASET_COLUMN_COUNT
+} dataset_column_t;
+
+typedef enum {
+    DATASET_CODEC_STORED,
+    DATASET_CODEC_RLE
+} dataset_codec_t;
+
+typedef struct {
+    char magic[4];
+    uint16_t version;
+    uint16_t column_count;
+} tetris_dataset_header_t;
+
+typedef struct {
+    uint32_t codec;
+    uint32_t raw_size;
+    uint32_t stored_size;	/* Without padding.	*/
+    uint32_t crc;			/* Of the stored bytes. */
+} tetris_dataset_column_header_t;
+
+typedef struct {
+    char magic[4];
+    uint32_t record_count;
+    tetris_dataset_column_header_t columns[DATASET_COLUMN_COUNT];
+} tetris_dataset_chunk_header_t;
+
+/* One decoded chunk. Stored columns point into the mapped file. */
+typedef struct {
+    int count;
+    const tetris_bitboard_t *boards;
+    const uint8_t *pieces;
+    const uint8_t *actions;
+    const uint8_t *lines;
+    const uint32_t *scores;
+} tetris_dataset_chunk_t;
+
+typedef struct tetris_dataset_writer tetris_dataset_writer_t;
+typedef struct tetris_dataset_reader tetris_dataset_reader_t;
+
+tetris_dataset_writer_t *dataset_writer_open(const char *path);
+
+void dataset_writer_append(tetris_dataset_writer_t *writer, const tetris_bitboard_t *board, const uint8_t *pieces,
+                           uint8_t action, uint8_t lines, uint32_t score);
+
+/* Writes the partial chunk, waits for the writer and prints the totals. Returns nonzero if any write failed. */
+int dataset_writer_close(tetris_dataset_writer_t *writer);
+
+tetris_dataset_reader_t *dataset_reader_open(const char *path);
+
+/* Returns 1 with the next chunk, 0 at the end of the file, -1 if the file is damaged. */
+int dataset_reader_next(tetris_dataset_reader_t *reader, tetris_dataset_chunk_t *chunk);
+
+void dataset_reader_close(tetris_dataset_reader_t *reader);
+
+/* Command line front ends. */
+int dataset_export(const tetris_options_t *options);
+
+int dataset_summary(const char *path);
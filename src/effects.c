@@ -0,0 +1,276 @@
+#include "effects.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <SDL.h>
+
+#define FLASH_SECONDS (0.25)		/* Full row flash, fading out.				*/
+#define COLLAPSE_SECONDS (0.30)		/* The flashed row then shrinks to nothing.	*/
+#define DEBRIS_PER_ROW (24)
+#define DEBRIS_SECONDS (0.70)
+#define SPARKS_PER_CELL (3)
+#define SPARK_SECONDS (0.35)
+#define GRAVITY (40.0f)				/* Cells per second squared.				*/
+
+struct tetris_effects {
+    int capacity, count;
+
+    /* One entry per quad, centered on x, y. */
+    float *x, *y;
+    float *vx, *vy;
+    float *w, *h;
+    float *shrink;				/* Height lost per second.				*/
+    float *gravity;
+    float *life, *ttl;			/* Seconds left and total, for the fade.	*/
+    float *delay;				/* Seconds before the quad shows up.		*/
+    uint32_t *color;
+
+    SDL_Vertex *vertices;		/* Four per quad, rebuilt every frame.	*/
+    int *indices;				/* Six per quad, filled once.			*/
+};
+
+tetris_effects_t *effects_create(int capacity) {
+    tetris_effects_t *effects = calloc(1, sizeof(*effects));
+    if (effects == NULL)
+        return NULL;
+
+    effects->capacity = capacity;
+
+    float **floats[] = {&effects->x, &effects->y, &effects->vx, &effects->vy, &effects->w, &effects->h,
+                        &effects->shrink, &effects->gravity, &effects->life, &effects->ttl, &effects->delay};
+
+    int ok = 1, i;
+    for (i = 0; i < sizeof floats / sizeof *floats; ++i) {
+        ok &= (*floats[i] = malloc(sizeof(float) * capacity)) != NULL;
+    }
+
+    effects->color = malloc(sizeof(*effects->color) * capacity);
+    effects->vertices = malloc(sizeof(*effects->vertices) * 4 * capacity);
+    effects->indices = malloc(sizeof(*effects->indices) * 6 * capacity);
+
+    if (!ok || effects->color == NULL || effects->vertices == NULL || effects->indices == NULL) {
+        puts("Failed to allocate the effects pool");
+        effects_destroy(effects);
+        return NULL;
+    }
+
+    for (i = 0; i < capacity; ++i) {
+        int *quad = &effects->indices[i * 6];
+        quad[0] = i * 4 + 0;
+        quad[1] = i * 4 + 1;
+        quad[2] = i * 4 + 2;
+        quad[3] = i * 4 + 2;
+        quad[4] = i * 4 + 3;
+        quad[5] = i * 4 + 0;
+    }
+
+    return effects;
+}
+
+void effects_destroy(tetris_effects_t *effects) {
+    if (effects == NULL) {
+        return;
+    }
+
+    free(effects->x);
+    free(effects->y);
+    free(effects->vx);
+    free(effects->vy);
+    free(effects->w);
+    free(effects->h);
+    free(effects->shrink);
+    free(effects->gravity);
+    free(effects->life);
+    free(effects->ttl);
+    free(effects->delay);
+    free(effects->color);
+    free(effects->vertices);
+    free(effects->indices);
+    free(effects);
+}
+
+void effects_clear(tetris_effects_t *effects) {
+    effects->count = 0;
+}
+
+/* Returns the index of a new quad with no motion, or -1 when the pool is full. */
+static int effects_spawn(tetris_effects_t *effects, float x, float y, float w, float h, float ttl, uint32_t color) {
+    if (effects->count >= effects->capacity) {
+        return -1;
+    }
+
+    const int i = effects->count++;
+
+    effects->x[i] = x;
+    effects->y[i] = y;
+    effects->vx[i] = 0;
+    effects->vy[i] = 0;
+    effects->w[i] = w;
+    effects->h[i] = h;
+    effects->shrink[i] = 0;
+    effects->gravity[i] = 0;
+    effects->life[i] = ttl;
+    effects->ttl[i] = ttl;
+    effects->delay[i] = 0;
+    effects->color[i] = color;
+
+    return i;
+}
+
+/* Uniform in [-1, 1]. */
+static float effects_random(void) {
+    return (float) random_number(2001) / 1000.0f - 1.0f;
+}
+
+void effects_lock(tetris_effects_t *effects, const tetris_piece_t *piece) {
+    int row;
+    for (row = 0; row < piece->h; ++row) {
+        int col;
+        for (col = 0; col < piece->w; ++col) {
+            if (piece->draw_data[row * piece->w + col] == 0) {
+                continue;
+            }
+
+            int k;
+            for (k = 0; k < SPARKS_PER_CELL; ++k) {
+                const int i = effects_spawn(effects, piece->x + col + 0.5f + 0.4f * effects_random(), piece->y + row + 1.0f,
+                                            0.15f, 0.15f, SPARK_SECONDS, 0xFFFFFF);
+                if (i < 0) {
+                    return;
+                }
+
+                effects->vx[i] = 3.0f * effects_random();
+                effects->vy[i] = -4.0f - 2.0f * effects_random();
+                effects->gravity[i] = GRAVITY;
+            }
+        }
+    }
+}
+
+void effects_line_clear(tetris_effects_t *effects, const int *rows, int count, int color) {
+    const float width = BOARD_COLUMNS - 2;
+
+    int r;
+    for (r = 0; r < count; ++r) {
+        const float y = rows[r] + 0.5f;
+
+        /* A bright flash over the row, then the same band squeezed flat. */
+        effects_spawn(effects, 1 + width / 2, y, width, 1.0f, FLASH_SECONDS, 0xFFFFFF);
+
+        const int band = effects_spawn(effects, 1 + width / 2, y, width, 1.0f, COLLAPSE_SECONDS, 0xFFFFFF);
+        if (band >= 0) {
+            effects->delay[band] = FLASH_SECONDS;
+            effects->shrink[band] = 1.0f / COLLAPSE_SECONDS;
+        }
+
+        int k;
+        for (k = 0; k < DEBRIS_PER_ROW; ++k) {
+            const int i = effects_spawn(effects, 1 + width * (effects_random() + 1) / 2, y, 0.3f, 0.3f,
+                                        DEBRIS_SECONDS, k % 3 == 0 ? 0xFFFFFF : (uint32_t) color);
+            if (i < 0) {
+                return;
+            }
+
+            effects->vx[i] = 4.0f * effects_random();
+            effects->vy[i] = -6.0f + 3.0f * effects_random();
+            effects->gravity[i] = GRAVITY;
+        }
+    }
+}
+
+bool effects_update(tetris_effects_t *effects, double dt) {
+    const float step = (float) dt;
+    const int count = effects->count;
+
+    int i;
+    for (i = 0; i < count; ++i) {
+        const float waited = effects->delay[i] < step ? effects->delay[i] : step;
+        const float t = step - waited;
+
+        effects->delay[i] -= waited;
+        effects->x[i] += effects->vx[i] * t;
+        effects->y[i] += effects->vy[i] * t;
+        effects->vy[i] += effects->gravity[i] * t;
+        effects->h[i] -= effects->shrink[i] * t;
+        effects->life[i] -= t;
+    }
+
+    /* Fill each finished slot with the last live quad; order does not matter. */
+    int n = count;
+    for (i = 0; i < n;) {
+        if (effects->life[i] > 0 && effects->h[i] > 0) {
+            ++i;
+            continue;
+        }
+
+        --n;
+        effects->x[i] = effects->x[n];
+        effects->y[i] = effects->y[n];
+        effects->vx[i] = effects->vx[n];
+        effects->vy[i] = effects->vy[n];
+        effects->w[i] = effects->w[n];
+        effects->h[i] = effects->h[n];
+        effects->shrink[i] = effects->shrink[n];
+        effects->gravity[i] = effects->gravity[n];
+        effects->life[i] = effects->life[n];
+        effects->ttl[i] = effects->ttl[n];
+        effects->delay[i] = effects->delay[n];
+        effects->color[i] = effects->color[n];
+    }
+    effects->count = n;
+
+    return n > 0;
+}
+
+int effects_draw(tetris_effects_t *effects, SDL_Renderer *renderer, double cell_width, double cell_height) {
+    const float cw = (float) cell_width, ch = (float) cell_height;
+    int quads = 0;
+
+    int i;
+    for (i = 0; i < effects->count; ++i) {
+        if (effects->delay[i] > 0) {
+            continue;
+        }
+
+        const float hw = effects->w[i] * cw / 2, hh = effects->h[i] * ch / 2;
+        const float cx = effects->x[i] * cw, cy = effects->y[i] * ch;
+        const uint32_t color = effects->color[i];
+
+        SDL_Color c;
+        c.r = (color >> 16) & 0xFF;
+        c.g = (color >> 8) & 0xFF;
+        c.b = color & 0xFF;
+        c.a = (Uint8) (255.0f * effects->life[i] / effects->ttl[i]);
+
+        SDL_Vertex *v = &effects->vertices[quads * 4];
+        v[0].position.x = cx - hw; v[0].position.y = cy - hh;
+        v[1].position.x = cx + hw; v[1].position.y = cy - hh;
+        v[2].position.x = cx + hw; v[2].position.y = cy + hh;
+        v[3].position.x = cx - hw; v[3].position.y = cy + hh;
+
+        int k;
+        for (k = 0; k < 4; ++k) {
+            v[k].color = c;
+            v[k].tex_coord.x = 0;
+            v[k].tex_coord.y = 0;
+        }
+
+        ++quads;
+    }
+
+    if (quads == 0) {
+        return 0;
+    }
+
+    /* Untextured geometry blends with the renderer's draw blend mode. */
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    const int status_code = SDL_RenderGeometry(renderer, NULL, effects->vertices, quads * 4, effects->indices, quads * 6);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+
+    if (status_code != 0) {
+        puts(SDL_GetError());
+    }
+
+    return status_code;
+}
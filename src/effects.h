@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "engine.h"
+
+/**
+ * Line clear and lock animations. Every effect is a colored quad in board
+ * cell units, kept in a fixed-capacity pool of parallel arrays: spawning never
+ * allocates and a full pool simply drops new quads. All live quads are drawn
+ * with a single SDL_RenderGeometry call. Effects are purely visual, the game
+ * keeps running while they play.
+ */
+
+#define EFFECTS_CAPACITY (2048)
+
+typedef struct tetris_effects tetris_effects_t;
+
+tetris_effects_t *effects_create(int capacity);
+
+void effects_destroy(tetris_effects_t *effects);
+
+/* Drops every live effect, for a new game. */
+void effects_clear(tetris_effects_t *effects);
+
+/* Burst of sparks from the cells of a piece that just locked. */
+void effects_lock(tetris_effects_t *effects, const tetris_piece_t *piece);
+
+/* Flash and collapse of the given board rows, with debris in the color of the piece that completed them. */
+void effects_line_clear(tetris_effects_t *effects, const int *rows, int count, int color);
+
+/* Advances the animations by dt seconds. Returns whether any effect is still playing. */
+bool effects_update(tetris_effects_t *effects, double dt);
+
+int effects_draw(tetris_effects_t *effects, SDL_Renderer *renderer, double cell_width, double cell_height);
@@ -1,10 +1,16 @@
 #include "engine.h"
+#include "font.h"
+#include "botproto.h"
+#include "beambot.h"
+#include "term.h"
+#include "effects.h"
 
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include <time.h>
 #include <stdint.h>
+#include <ctype.h>
 
 #include <SDL.h>
 #include <SDL_ttf.h>
@@ -50,12 +56,11 @@ tetris_shape_info_t g_tetris_shape_table[] =
                 {.width = 3, .height = 2, .data = g_shape_z}
         };
 
+/* The generator is seeded once by context_create. */
 int random_number(int upper_limit) {
 #ifdef __APPLE__
     return random() % upper_limit;
 #endif
-    srand(time(NULL));
-
     return rand() % upper_limit;
 }
 
@@ -84,17 +89,121 @@ int darken_color(uint32_t color, double amount) {
     return (r << 16) | (g << 8) | b;
 }
 
+static const char g_shape_letters[SHAPE_END] = {'J', 'L', 'I', 'O', 'S', 'T', 'Z'};
+
+char shape_letter(tetris_shape_kind_t shape) {
+    return shape < SHAPE_END ? g_shape_letters[shape] : '?';
+}
+
+/* Returns SHAPE_END for letters that do not name a piece. */
+tetris_shape_kind_t shape_from_letter(char letter) {
+    int shape;
+    for (shape = 0; shape < SHAPE_END; ++shape) {
+        if (g_shape_letters[shape] == toupper((unsigned char) letter)) {
+            return shape;
+        }
+    }
+
+    return SHAPE_END;
+}
+
+/* Fills cells with the shape after the given number of clockwise quarter turns,
+ * using the same transform as the in-game rotation. cells must hold w * h ints. */
+void shape_rotate(tetris_shape_kind_t shape, int rotation, int *cells, int *w, int *h) {
+    const tetris_shape_info_t info = g_tetris_shape_table[shape];
+    int buffer[16];
+
+    *w = info.width;
+    *h = info.height;
+    memcpy(cells, info.data, sizeof(int) * info.width * info.height);
+
+    for (rotation %= 4; rotation > 0; --rotation) {
+        int y;
+        for (y = 0; y < *h; ++y) {
+            int x;
+            for (x = 0; x < *w; ++x) {
+                buffer[x * *h + (*h - y - 1)] = cells[y * *w + x];
+            }
+        }
+
+        memcpy(cells, buffer, sizeof(int) * *w * *h);
+
+        const int temp = *w;
+        *w = *h;
+        *h = temp;
+    }
+}
+
+int board_create(tetris_board_t *board, int rows) {
+    memset(board, 0, sizeof(*board));
+
+    if (rows < 3 || rows > BOARD_ROWS_MAX) {
+        printf("Board height must be between 3 and %d rows\n", BOARD_ROWS_MAX);
+        return 1;
+    }
+
+    board->rows = rows;
+    board->storage = malloc(sizeof(*board->storage) * rows * BOARD_COLUMNS);
+    board->table = malloc(sizeof(*board->table) * rows * 2);
+
+    if (board->storage == NULL || board->table == NULL) {
+        puts("Failed to allocate the board");
+        board_destroy(board);
+        return 1;
+    }
+
+    board_initialize(board);
+
+    return 0;
+}
+
+/* Points row y at cells, in both halves of the ring. */
+static void board_set_row(tetris_board_t *board, int y, int *cells) {
+    int slot = board->base + y;
+    if (slot >= board->rows) {
+        slot -= board->rows;
+    }
+
+    board->table[slot] = cells;
+    board->table[slot + board->rows] = cells;
+}
+
+/* Rows in storage order with the ring unrotated. */
+static void board_reset_rows(tetris_board_t *board) {
+    board->base = 0;
+    board->row = board->table;
+
+    int y;
+    for (y = 0; y < board->rows; ++y) {
+        board_set_row(board, y, board->storage + y * BOARD_COLUMNS);
+    }
+}
+
+/* Copies cells in row order; the copy gets its own row table. */
+void board_copy(tetris_board_t *dst, const tetris_board_t *src) {
+    board_reset_rows(dst);
+
+    int y;
+    for (y = 0; y < src->rows; ++y) {
+        memcpy(dst->row[y], src->row[y], sizeof(*dst->storage) * BOARD_COLUMNS);
+    }
+
+    dst->current_piece = NULL;
+}
+
 void board_initialize(tetris_board_t *board) {
     board->current_piece = NULL;
 
+    board_reset_rows(board);
+
     int i;
-    for (i = 0; i < BOARD_ROWS; ++i) {
+    for (i = 0; i < board->rows; ++i) {
         int j;
         for (j = 0; j < BOARD_COLUMNS; ++j) {
-            if (j > 0 && j < BOARD_COLUMNS - 1 && i > 0 && i < BOARD_ROWS - 1) {
-                board->cells[i * BOARD_COLUMNS + j] = g_tetris_colors[COLOR_NONE];
+            if (j > 0 && j < BOARD_COLUMNS - 1 && i > 0 && i < board->rows - 1) {
+                board->row[i][j] = g_tetris_colors[COLOR_NONE];
             } else {
-                board->cells[i * BOARD_COLUMNS + j] = g_tetris_colors[COLOR_MARGIN];
+                board->row[i][j] = g_tetris_colors[COLOR_MARGIN];
             }
         }
     }
@@ -106,7 +215,14 @@ void board_destroy(tetris_board_t *board) {
             free(board->current_piece->draw_data);
         }
         free(board->current_piece);
+        board->current_piece = NULL;
     }
+
+    free(board->storage);
+    free(board->table);
+    board->storage = NULL;
+    board->table = NULL;
+    board->row = NULL;
 }
 
 void board_fixate_current_piece(tetris_board_t *board) {
@@ -123,7 +239,7 @@ void board_fixate_current_piece(tetris_board_t *board) {
             if (piece->draw_data[row * piece->w + col] != 0) {
                 const int xpos = piece->x + col;
                 const int ypos = piece->y + row;
-                board->cells[ypos * BOARD_COLUMNS + xpos] = piece->color;
+                board->row[ypos][xpos] = piece->color;
             }
         }
     }
@@ -133,6 +249,7 @@ void board_spawn_piece(tetris_context_t *ctx) {
     tetris_board_t *board = &ctx->board;
 
     if (board->current_piece != NULL) {
+        free(board->current_piece->draw_data);
         free(board->current_piece);
         board->current_piece = NULL;
     }
@@ -142,9 +259,12 @@ void board_spawn_piece(tetris_context_t *ctx) {
         return;
 
     piece->color = g_tetris_colors[random_number(COLOR_NONE)];
-    piece->shape = random_number(SHAPE_END);
-    piece->x = 5;
-    piece->y = 1;
+    piece->shape = ctx->next_pieces[0];
+    piece->x = PIECE_SPAWN_X;
+    piece->y = PIECE_SPAWN_Y;
+
+    memmove(ctx->next_pieces, ctx->next_pieces + 1, sizeof(*ctx->next_pieces) * (PIECE_QUEUE_SIZE - 1));
+    ctx->next_pieces[PIECE_QUEUE_SIZE - 1] = random_number(SHAPE_END);
 
     tetris_shape_info_t info = g_tetris_shape_table[piece->shape];
     piece->w = info.width;
@@ -161,6 +281,10 @@ void board_spawn_piece(tetris_context_t *ctx) {
     board->current_piece = piece;
 
     ctx->stats.pieces_spawned += 1;
+
+    ctx->piece_metrics.spawn_time = SDL_GetTicks() - ctx->stats.start_time;
+    ctx->piece_metrics.inputs = 0;
+    ctx->piece_metrics.rotations = 0;
 }
 
 void context_reset(tetris_context_t *ctx) {
@@ -170,55 +294,101 @@ void context_reset(tetris_context_t *ctx) {
 
     ctx->stats.start_time = SDL_GetTicks();
     ctx->stats.end_time = ctx->stats.lines_cleared = ctx->stats.pieces_spawned = 0;
+    ctx->game_id += 1;
 
     board_initialize(&ctx->board);
+
+    if (ctx->effects != NULL) {
+        effects_clear(ctx->effects);
+    }
+
+    int i;
+    for (i = 0; i < PIECE_QUEUE_SIZE; ++i) {
+        ctx->next_pieces[i] = random_number(SHAPE_END);
+    }
+
+    ctx->needs_redraw = true;
 }
 
 void game_update_title(tetris_context_t *ctx) {
     static char buffer[1024];
     *buffer = 0;
     
+    if (ctx->window == NULL) {
+        return;
+    }
+
     snprintf(buffer, sizeof(buffer), "Not Tetris - %dx%d", ctx->w_width, ctx->w_height);
     SDL_SetWindowTitle(ctx->window, buffer);
 }
 
-tetris_context_t *context_create(void) {
-    puts("Initializing SDL2...");
+void options_init(tetris_options_t *options) {
+    memset(options, 0, sizeof(*options));
+
+    options->das_ms = DAS_DEFAULT_MS;
+    options->arr_ms = ARR_DEFAULT_MS;
+    options->bot_budget_ms = BOT_BUDGET_DEFAULT_MS;
+    options->board_rows = BOARD_ROWS;
+    options->beam_width = BEAM_WIDTH_DEFAULT;
+    options->beam_lookahead = BEAM_LOOKAHEAD_DEFAULT;
+    options->video_output = "-";
+    options->video_fps = FRAMERATE_DEFAULT;
+    options->video_width = W_WIDTH_DEFAULT;
+    options->video_height = W_HEIGHT_DEFAULT;
+}
 
-    if (SDL_Init(SDL_INIT_EVERYTHING) != 0) {
-        puts("Failed to initialize SDL");
-        puts(SDL_GetError());
-        return NULL;
+static void startup_begin(tetris_startup_report_t *report, bool enabled) {
+    memset(report, 0, sizeof(*report));
+    report->enabled = enabled;
+    report->begin = report->last = SDL_GetPerformanceCounter();
+}
+
+/* Records the time spent since the previous mark under the given phase name. */
+void startup_mark(tetris_startup_report_t *report, const char *phase) {
+    if (!report->enabled || report->printed || report->phase_count >= STARTUP_PHASE_MAX) {
+        return;
     }
 
-    puts("Initializing SDL_TTF...");
+    const uint64_t now = SDL_GetPerformanceCounter();
 
-    if (TTF_Init() != 0) {
-        puts("Failed to initialize SDL_TTF");
-        puts(TTF_GetError());
-        SDL_Quit();
-        return NULL;
+    tetris_startup_phase_t *entry = &report->phases[report->phase_count++];
+    entry->name = phase;
+    entry->seconds = (double) (now - report->last) / (double) SDL_GetPerformanceFrequency();
+
+    report->last = now;
+}
+
+void startup_print(tetris_startup_report_t *report) {
+    if (!report->enabled || report->printed) {
+        return;
     }
 
-    puts("Initializing context...");
+    report->printed = true;
 
-    tetris_context_t *ctx = calloc(1, sizeof(*ctx));
-    if (ctx == NULL)
-        return NULL;
+    const double frequency = (double) SDL_GetPerformanceFrequency();
 
-    ctx->w_width = W_WIDTH_DEFAULT;
-    ctx->w_height = W_HEIGHT_DEFAULT;
+    puts("Startup report:");
 
+    int i;
+    for (i = 0; i < report->phase_count; ++i) {
+        printf("  %-20s %8.2f ms\n", report->phases[i].name, report->phases[i].seconds * 1000.0);
+    }
+
+    printf("  %-20s %8.2f ms\n", "total", (double) (report->last - report->begin) / frequency * 1000.0);
+}
+
+static int context_create_window(tetris_context_t *ctx, tetris_startup_report_t *startup) {
     int position = SDL_WINDOWPOS_CENTERED;
 
     ctx->window = SDL_CreateWindow("Not tetris", position, position, ctx->w_width, ctx->w_height, SDL_WINDOW_SHOWN);
 
     if (ctx->window == NULL) {
         puts("Failed to create window");
-        free(ctx);
-        return NULL;
+        return 1;
     }
 
+    startup_mark(startup, "create window");
+
     ctx->renderer = SDL_CreateRenderer(ctx->window, -1, SDL_RENDERER_ACCELERATED);
 
     if (ctx->renderer == NULL) {
@@ -228,11 +398,77 @@ tetris_context_t *context_create(void) {
         if (ctx->renderer == NULL) {
             SDL_DestroyWindow(ctx->window);
             puts("Failed to create software renderer.");
-            free(ctx);
-            return NULL;
+            ctx->window = NULL;
+            return 1;
         }
     }
 
+    startup_mark(startup, "create renderer");
+
+    SDL_SetRenderDrawBlendMode(ctx->renderer, SDL_BLENDMODE_BLEND);
+
+    return 0;
+}
+
+tetris_context_t *context_create(const tetris_options_t *options) {
+    tetris_startup_report_t startup;
+    startup_begin(&startup, options->startup_report);
+
+#ifdef __APPLE__
+    srandom((unsigned int) time(NULL));
+#endif
+    srand((unsigned int) time(NULL));
+
+    puts("Initializing SDL2...");
+
+    /* Video brings up the event subsystem as well, which is all the game needs.
+     * The terminal frontend needs neither. */
+    if (SDL_Init(options->terminal ? 0 : SDL_INIT_VIDEO) != 0) {
+        puts("Failed to initialize SDL");
+        puts(SDL_GetError());
+        return NULL;
+    }
+
+    startup_mark(&startup, "SDL_Init");
+
+    puts("Initializing context...");
+
+    tetris_context_t *ctx = calloc(1, sizeof(*ctx));
+    if (ctx == NULL)
+        return NULL;
+
+    ctx->options = *options;
+
+    if (board_create(&ctx->board, options->board_rows) != 0) {
+        free(ctx);
+        return NULL;
+    }
+    ctx->w_width = W_WIDTH_DEFAULT;
+    ctx->w_height = W_HEIGHT_DEFAULT;
+
+    int status_code;
+    if (options->terminal) {
+        ctx->term = term_open();
+        ctx->collect_events = term_collect_events;
+        ctx->draw = term_draw;
+        status_code = ctx->term == NULL;
+    } else {
+        ctx->collect_events = game_collect_events;
+        ctx->draw = game_draw;
+        status_code = context_create_window(ctx, &startup);
+
+        /* Purely cosmetic: the game runs the same without them. */
+        if (status_code == 0 && (ctx->effects = effects_create(EFFECTS_CAPACITY)) == NULL) {
+            puts("Continuing without effects");
+        }
+    }
+
+    if (status_code != 0) {
+        board_destroy(&ctx->board);
+        free(ctx);
+        return NULL;
+    }
+
 	ctx->target_framerate = FRAMERATE_DEFAULT;
 	ctx->event_stack_top = 0;
 	ctx->last_frame_duration = 0;
@@ -241,28 +477,82 @@ tetris_context_t *context_create(void) {
 	ctx->last_time = -1;
 	ctx->score = 0;
 	ctx->font = NULL;
-
-    SDL_SetRenderDrawBlendMode(ctx->renderer, SDL_BLENDMODE_BLEND);
+	ctx->font_attempted = false;
 
     context_reset(ctx);
 
-    ctx->font = TTF_OpenFont(FONT_LOCATION FONT_NAME, 24);
+    if ((options->bot_command != NULL || options->beam_bot) && options->board_rows != BOARD_ROWS) {
+        printf("The bots only play on boards of %d rows\n", BOARD_ROWS - 2);
+    } else if (options->bot_command != NULL) {
+        ctx->bot = bot_link_open(options->bot_command, options->bot_binary, options->bot_budget_ms);
+        if (ctx->bot == NULL) {
+            puts("Continuing without the external bot");
+        }
+    } else if (options->beam_bot) {
+        ctx->beambot = beambot_create(options->beam_width, options->beam_lookahead, options->threads);
+    }
+
+    if (options->telemetry_path != NULL && options->board_rows != BOARD_ROWS) {
+        printf("Telemetry is only recorded on boards of %d rows\n", BOARD_ROWS - 2);
+    } else if (options->telemetry_path != NULL) {
+        ctx->telemetry = telemetry_open(options->telemetry_path);
+        if (ctx->telemetry == NULL) {
+            puts("Continuing without telemetry");
+        } else {
+            /* Number this run's games after the ones already in the log. */
+            ctx->game_id = telemetry_last_game_id(ctx->telemetry) + 1;
+        }
+    }
+
+    game_update_title(ctx);
+
+    startup_mark(&startup, "context setup");
+
+    /* The font is loaded on first use, so the remaining phases are recorded by the first frame. */
+    ctx->startup = startup;
+
+    return ctx;
+}
+
+/* Opens the embedded font the first time text is drawn. A failure is reported once. */
+static TTF_Font *context_get_font(tetris_context_t *ctx) {
+    if (ctx->font != NULL || ctx->font_attempted) {
+        return ctx->font;
+    }
+
+    ctx->font_attempted = true;
+
+    if (!TTF_WasInit() && TTF_Init() != 0) {
+        puts("Failed to initialize SDL_TTF");
+        puts(TTF_GetError());
+        return NULL;
+    }
+
+    SDL_RWops *rw = SDL_RWFromConstMem(g_font_ttf, (int) g_font_ttf_size);
+    ctx->font = rw != NULL ? TTF_OpenFontRW(rw, 1, FONT_SIZE) : NULL;
 
     if (ctx->font == NULL) {
         puts(TTF_GetError());
         puts("Failed to load font. Score will not be available during gameplay");
     }
-    
-    game_update_title(ctx);
 
-    return ctx;
+    startup_mark(&ctx->startup, "load font");
+
+    return ctx->font;
 }
 
 void context_destroy(tetris_context_t *ctx) {
-    SDL_DestroyRenderer(ctx->renderer);
-    SDL_DestroyWindow(ctx->window);
+    if (ctx->renderer != NULL) {
+        SDL_DestroyRenderer(ctx->renderer);
+        SDL_DestroyWindow(ctx->window);
+    }
+    term_close(ctx->term);
+    effects_destroy(ctx->effects);
 
     board_destroy(&ctx->board);
+    telemetry_close(ctx->telemetry);
+    bot_link_close(ctx->bot);
+    beambot_destroy(ctx->beambot);
     
     if (ctx->font != NULL) {
         TTF_CloseFont(ctx->font);
@@ -270,11 +560,13 @@ void context_destroy(tetris_context_t *ctx) {
 
     free(ctx);
 
-    TTF_Quit();
+    if (TTF_WasInit()) {
+        TTF_Quit();
+    }
     SDL_Quit();
 }
 
-int game_push_event(tetris_context_t *ctx, tetris_event_kind_t kind, int64_t data) {
+int game_push_event(tetris_context_t *ctx, tetris_event_kind_t kind, int64_t data, uint64_t timestamp, bool repeat) {
     if (ctx->event_stack_top >= EVENT_STACK_SIZE) {
         puts("Fatal error: Event stack overflow");
         return 2;
@@ -282,41 +574,71 @@ int game_push_event(tetris_context_t *ctx, tetris_event_kind_t kind, int64_t dat
 
     tetris_event_t *event = &(ctx->event_stack[ctx->event_stack_top++]);
     event->data = data;
+    event->timestamp = timestamp;
+    event->repeat = repeat;
     event->kind = kind;
 
     return 0;
 }
 
+static int game_handle_window_event(tetris_context_t *ctx, const SDL_WindowEvent *e) {
+    switch (e->event) {
+        case SDL_WINDOWEVENT_FOCUS_GAINED:
+        case SDL_WINDOWEVENT_RESTORED:
+            return game_push_event(ctx, EVENT_FOCUS_REGAIN, 0, e->timestamp, false);
+        case SDL_WINDOWEVENT_FOCUS_LOST:
+        case SDL_WINDOWEVENT_MINIMIZED:
+            return game_push_event(ctx, EVENT_FOCUS_LOST, 0, e->timestamp, false);
+        case SDL_WINDOWEVENT_EXPOSED:
+        case SDL_WINDOWEVENT_SIZE_CHANGED:
+            ctx->needs_redraw = true;
+            return 0;
+        case SDL_WINDOWEVENT_CLOSE:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+static int game_handle_event(tetris_context_t *ctx, const SDL_Event *e) {
+    switch (e->type) {
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+            return game_push_event(ctx, e->type == SDL_KEYDOWN ? EVENT_KEYDOWN : EVENT_KEYUP,
+                                   e->key.keysym.sym, e->key.timestamp, e->key.repeat != 0);
+        case SDL_WINDOWEVENT:
+            return game_handle_window_event(ctx, &e->window);
+        case SDL_QUIT:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
 int game_collect_events(tetris_context_t *ctx) {
     SDL_Event e;
+    int status_code;
+
+    /* Nothing moves while paused, so sleep until something happens instead of polling. */
+    if (ctx->paused && !ctx->needs_redraw && SDL_WaitEventTimeout(&e, IDLE_WAIT_MS)) {
+        if ((status_code = game_handle_event(ctx, &e)) != 0) {
+            return status_code;
+        }
+    }
 
     while (SDL_PollEvent(&e)) {
-        switch (e.type) {
-            case SDL_KEYDOWN:
-                return game_push_event(ctx, EVENT_KEYDOWN, e.key.keysym.sym);
-            case SDL_WINDOWEVENT_FOCUS_GAINED:
-            case SDL_WINDOWEVENT_RESTORED:
-                return game_push_event(ctx, EVENT_FOCUS_REGAIN, 0);
-            case SDL_WINDOWEVENT_FOCUS_LOST:
-            case SDL_WINDOWEVENT_MINIMIZED:
-                return game_push_event(ctx, EVENT_FOCUS_LOST, 0);
-            case SDL_WINDOWEVENT_MOVED:
-                SDL_SetWindowPosition(ctx->window, e.window.data1, e.window.data2);
-                break;
-            case SDL_WINDOWEVENT_CLOSE:
-            case SDL_QUIT:
-                return 1;
-            default:
-                return 0;
+        if ((status_code = game_handle_event(ctx, &e)) != 0) {
+            return status_code;
         }
     }
 
     return 0;
 }
 
-void query_board_size(tetris_context_t *ctx, double *width, double *height) {
-    const double vert_region = ctx->w_height;
-    const double hori_region = vert_region * ((double) BOARD_COLUMNS / (double) BOARD_ROWS);
+/* The board takes the full output height and keeps the cells square. */
+void board_layout_size(int output_height, int rows, double *width, double *height) {
+    const double vert_region = output_height;
+    const double hori_region = vert_region * ((double) BOARD_COLUMNS / (double) rows);
 
     if (height != NULL) {
         *height = vert_region;
@@ -327,13 +649,17 @@ void query_board_size(tetris_context_t *ctx, double *width, double *height) {
     }
 }
 
+void query_board_size(tetris_context_t *ctx, double *width, double *height) {
+    board_layout_size(ctx->w_height, ctx->board.rows, width, height);
+}
+
 void draw_single_block(tetris_context_t *ctx, int x, int y, int color) {
     double bw, bh;
 
     query_board_size(ctx, &bw, &bh);
 
     const double cell_width = bw / BOARD_COLUMNS;
-    const double cell_height = bh / BOARD_ROWS;
+    const double cell_height = bh / ctx->board.rows;
 
     SDL_FRect rect;
 
@@ -352,20 +678,17 @@ void draw_single_block(tetris_context_t *ctx, int x, int y, int color) {
 }
 
 int board_get_cell(const tetris_board_t *board, int x, int y) {
-    return board->cells[y * BOARD_COLUMNS + x];
+    return board->row[y][x];
 }
 
 int draw_existing_blocks(tetris_context_t *ctx) {
-    int i, x = 0, y = 0;
-    for (i = 0; i < BOARD_SIZE; ++i) {
-        if (x % BOARD_COLUMNS == 0 && i > 0) {
-            y += 1;
-            x = 0;
-        }
-
-        draw_single_block(ctx, x, y, ctx->board.cells[i]);
+    int x, y;
+    for (y = 0; y < ctx->board.rows; ++y) {
+        const int *cells = ctx->board.row[y];
 
-        x += 1;
+        for (x = 0; x < BOARD_COLUMNS; ++x) {
+            draw_single_block(ctx, x, y, cells[x]);
+        }
     }
 
     return 0;
@@ -389,17 +712,32 @@ int draw_current_piece(tetris_context_t *ctx) {
     return 0;
 }
 
-static void clear_board_row(tetris_board_t *board, int row) {
+/* Number of rows between the floor and the highest filled cell. */
+int board_stack_height(const tetris_board_t *board) {
+    int row;
+    for (row = 1; row < board->rows - 1; ++row) {
+        int col;
+        for (col = 1; col < BOARD_COLUMNS - 1; ++col) {
+            if (board_get_cell(board, col, row) != g_tetris_colors[COLOR_NONE]) {
+                return board->rows - 1 - row;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static void clear_board_row(int *cells) {
     int col;
     for (col = 1; col < BOARD_COLUMNS - 1; ++col) {
-        board->cells[row * BOARD_COLUMNS + col] = g_tetris_colors[COLOR_NONE];
+        cells[col] = g_tetris_colors[COLOR_NONE];
     }
 }
 
-static int row_has_empty_cell(tetris_board_t *board, int row) {
+static int row_has_empty_cell(const int *cells) {
     int col, has_empty = 0;
     for (col = 1; col < BOARD_COLUMNS; ++col) {
-        if (board->cells[row * BOARD_COLUMNS + col] == g_tetris_colors[COLOR_NONE]) {
+        if (cells[col] == g_tetris_colors[COLOR_NONE]) {
             has_empty = 1;
             break;
         }
@@ -408,84 +746,121 @@ static int row_has_empty_cell(tetris_board_t *board, int row) {
     return has_empty;
 }
 
-static int row_is_all_empty(tetris_board_t *board, int row) {
-    int col, all_empty = 1;
-    for (col = 1; col < BOARD_COLUMNS - 1; ++col) {
-        if (board->cells[row * BOARD_COLUMNS + col] != g_tetris_colors[COLOR_NONE]) {
-            all_empty = 0;
-            break;
-        }
-    }
-    return all_empty;
-}
-
-static void move_cells_above_line(tetris_board_t *board, int cleared_row) {
-    int row, last_row = 1;
-    for (row = cleared_row - 1; row >= 1; --row) {
-        if (row_is_all_empty(board, row)) {
-            last_row = row + 1;
-            break;
-        }
+/**
+ * Drops every row above the cleared one by one and recycles the cleared row,
+ * now empty, as the new top row. Only row pointers move, never cells, and
+ * only those on the shorter side of the cleared row.
+ */
+static void unlink_board_row(tetris_board_t *board, int cleared_row) {
+    int *cells = board->row[cleared_row];
+    int *top_margin = board->row[0];
+    int y;
 
-        int col;
-        for (col = 1; col < BOARD_COLUMNS - 1; ++col) {
-            int source_index = row * BOARD_COLUMNS + col;
-            int target_index = (row + 1) * BOARD_COLUMNS + col;
+    clear_board_row(cells);
 
-            board->cells[target_index] = board->cells[source_index];
+    if (cleared_row - 1 <= board->rows - 1 - cleared_row) {
+        for (y = cleared_row; y > 1; --y) {
+            board_set_row(board, y, board->row[y - 1]);
         }
+        board_set_row(board, 1, cells);
+        return;
+    }
+
+    /* Lift the rows below, floor included, then turn the ring down one slot:
+     * the rows above drop by one without being touched. */
+    for (y = cleared_row; y < board->rows - 1; ++y) {
+        board_set_row(board, y, board->row[y + 1]);
     }
 
-    clear_board_row(board, last_row);
+    board->base = board->base == 0 ? board->rows - 1 : board->base - 1;
+    board->row = board->table + board->base;
+
+    board_set_row(board, 0, top_margin);
+    board_set_row(board, 1, cells);
 }
 
-double game_get_piece_fall_time(tetris_context_t* ctx)
+double fall_time_for_score(unsigned int score)
 {
 	/* Linearly interpolate between fall times, capping at the end game value. */
-	double pos = ctx->score / FALL_TIME_SCORE_RANGE;
+	double pos = score / FALL_TIME_SCORE_RANGE;
 	double delta = ((double)FALL_TIME_SECONDS_END - (double)FALL_TIME_SECONDS_BEG);
 	if (pos > 1.0) pos = 1.0;
 
 	return FALL_TIME_SECONDS_BEG + delta * pos;
 }
 
-void board_check_for_clears(tetris_context_t *ctx) {
-	unsigned int clears;
+double game_get_piece_fall_time(tetris_context_t* ctx)
+{
+	return fall_time_for_score(ctx->score);
+}
+
+/* Points awarded for clearing the given number of rows at once with the given current score. */
+unsigned int score_for_clears(unsigned int score, int clears)
+{
 	double fall_time, added;
-    int row;
 
-	clears = 0;
-    for(row = BOARD_ROWS - 2; row >= 1; --row) {
-        if(!row_has_empty_cell(&ctx->board, row)) {
-            clear_board_row(&ctx->board, row);
-            move_cells_above_line(&ctx->board, row);
+	if (clears <= 0)
+		return 0;
+
+	fall_time = fall_time_for_score(score);
+
+	switch (clears) {
+	case 1: added = SCORE_BASE_SINGLE / fall_time; break;
+	case 2: added = SCORE_BASE_DOUBLE / fall_time; break;
+	case 3: added = SCORE_BASE_TRIPLE / fall_time; break;
+	default:
+		/* Tetris is special. */
+		added = SCORE_BASE_TETRIS / 4.0 * clears / fall_time;
+		break;
+	}
+
+	return (unsigned int) round(added);
+}
 
-            ctx->stats.lines_cleared += 1;
+int board_clear_full_rows(tetris_board_t *board, int first, int count, int *cleared) {
+    int row, last = first + count, clears = 0;
 
-            row += 1;
-			++clears;
+    /* Never look at the margin rows. */
+    if (first < 1) first = 1;
+    if (last > board->rows - 1) last = board->rows - 1;
+
+    /* Top down, so unlinking a row leaves the indices of the rows below it alone. */
+    for (row = first; row < last; ++row) {
+        if (!row_has_empty_cell(board->row[row])) {
+            unlink_board_row(board, row);
+            if (cleared != NULL) {
+                cleared[clears] = row;
+            }
+            ++clears;
         }
     }
 
+    return clears;
+}
+
+void board_check_for_clears(tetris_context_t *ctx) {
+	unsigned int clears;
+	int cleared[4];
+
+	const tetris_piece_t *piece = ctx->board.current_piece;
+	if (piece == NULL)
+		return;
+
+	/* Only rows the piece touched can have become full. */
+	clears = board_clear_full_rows(&ctx->board, piece->y, piece->h, cleared);
+	ctx->stats.lines_cleared += clears;
+
+	if (clears > 0 && ctx->effects != NULL) {
+		effects_line_clear(ctx->effects, cleared, clears, piece->color);
+	}
+
 	/* Apply score based on how much was cleared. */
 	if (clears > 0) {
-		added = 0;
-		fall_time = game_get_piece_fall_time(ctx);
-
-		switch (clears) {
-		case 1: added = SCORE_BASE_SINGLE / fall_time; break;
-		case 2: added = SCORE_BASE_DOUBLE / fall_time; break;
-		case 3: added = SCORE_BASE_TRIPLE / fall_time; break;
-		default:
-			/* Tetris is special. */
-			added = SCORE_BASE_TETRIS / 4.0 * clears / fall_time;
-			break;
-		}
-
-		ctx->score += (unsigned int) round(added);
+		ctx->score += score_for_clears(ctx->score, clears);
         
         if (ctx->score_texture != NULL) {
             SDL_DestroyTexture(ctx->score_texture);
+            ctx->score_texture = NULL;
         }
 	}
 }
@@ -504,7 +879,7 @@ static SDL_Texture* create_text_texture(tetris_context_t* ctx, const char * text
   Rows are on a fixed x position relative to the board
  */
 int draw_text (tetris_context_t *ctx, SDL_Texture* texture, int row) {
-    if (ctx->font == NULL) {
+    if (ctx->font == NULL || texture == NULL) {
         return 0;
     }
     
@@ -528,6 +903,10 @@ int draw_score(tetris_context_t* ctx) {
     SDL_Color color = {255, 255, 255};
     
     static char buffer[256];
+    if (context_get_font(ctx) == NULL) {
+        return 0;
+    }
+
     if (ctx->score_texture == NULL) {
         // Draw the score value.
         snprintf(buffer, sizeof buffer, "Score: %d", ctx->score);
@@ -539,10 +918,25 @@ int draw_score(tetris_context_t* ctx) {
 	return 0;
 }
 
+int draw_effects(tetris_context_t *ctx) {
+    if (ctx->effects == NULL) {
+        return 0;
+    }
+
+    double bw, bh;
+    query_board_size(ctx, &bw, &bh);
+
+    return effects_draw(ctx->effects, ctx->renderer, bw / BOARD_COLUMNS, bh / ctx->board.rows);
+}
+
 int game_draw(tetris_context_t *ctx) {
     int status_code = 0;
 
-    game_loop_fn_t draw_functions[] = {draw_existing_blocks, draw_current_piece, draw_score};
+    if (!ctx->needs_redraw) {
+        return 0;
+    }
+
+    game_loop_fn_t draw_functions[] = {draw_existing_blocks, draw_current_piece, draw_effects, draw_score};
 
     SDL_SetRenderDrawColor(ctx->renderer, 0, 0, 0, 255);
     SDL_RenderClear(ctx->renderer);
@@ -559,12 +953,17 @@ int game_draw(tetris_context_t *ctx) {
     }
 
     SDL_RenderPresent(ctx->renderer);
+    ctx->needs_redraw = false;
+
+    startup_mark(&ctx->startup, "first frame");
+    startup_print(&ctx->startup);
 
     return status_code;
 }
 
 int game_run(tetris_context_t *ctx, game_loop_fn_t game_update) {
     int status_code, quit = 0;
+    const bool was_paused = ctx->paused;
 
 	/* This inter-frame timer is a tad more accurate. */
 	if (ctx->last_time == -1)
@@ -580,7 +979,7 @@ int game_run(tetris_context_t *ctx, game_loop_fn_t game_update) {
 
 	const int target_ticks = (1000 / ctx->target_framerate);
 
-    game_loop_fn_t game_loop_functions[] = {game_collect_events, game_update, game_draw};
+    game_loop_fn_t game_loop_functions[] = {ctx->collect_events, game_update, ctx->draw};
 
     uint64_t frame_ticks = SDL_GetTicks();
 
@@ -603,5 +1002,11 @@ int game_run(tetris_context_t *ctx, game_loop_fn_t game_update) {
 
     ctx->last_frame_duration = elapsed / 1000.0;
 
+    /* A paused frame can sleep in SDL_WaitEventTimeout. Start the clock over so
+     * the first frame after resuming does not see that time as game time. */
+    if (was_paused) {
+        ctx->last_time = -1;
+    }
+
     return quit;
 }
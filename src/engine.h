@@ -3,25 +3,26 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "telemetry.h"
+
 #define EVENT_STACK_SIZE (128)
 #define W_WIDTH_DEFAULT (900)
 #define W_HEIGHT_DEFAULT (600)
 #define FRAMERATE_DEFAULT (60)
-#define BOARD_ROWS (22)
+#define DAS_DEFAULT_MS (167)	/* Delay before a held horizontal key starts repeating.		*/
+#define ARR_DEFAULT_MS (33)		/* Time between repeated shifts, 0 shifts to the wall at once.	*/
+#define BOARD_ROWS (22)		/* Standard height, margin rows included.		*/
+#define BOARD_ROWS_MAX (1026)	/* Tallest board --rows accepts, margins included.	*/
 #define BOARD_COLUMNS (12)
-#define BOARD_SIZE (BOARD_ROWS * BOARD_COLUMNS)
+#define PIECE_SPAWN_X (5)
+#define PIECE_SPAWN_Y (1)
+#define PIECE_QUEUE_SIZE (5)	/* Upcoming pieces that are known in advance.	*/
+#define BOT_BUDGET_DEFAULT_MS (100)
 #define DARK_AMOUNT (0.25)
+#define IDLE_WAIT_MS (500)		/* Longest block in SDL_WaitEventTimeout while idle. */
 
-#ifdef __APPLE__
-# define FONT_LOCATION "/System/Library/Fonts/"
-#define FONT_NAME "Monaco.ttf"
-#elif defined(WIN32) || defined(_WIN32)
-# define FONT_LOCATION "C:\\Windows\\Fonts\\"
-#define FONT_NAME "Consolas.ttf"
-#else
-# define FONT_LOCATION "/usr/share/fonts/"
-#define FONT_NAME "Consolas.ttf"
-#endif
+#define FONT_SIZE (30)		/* Multiple of 10 so the embedded pixel font stays sharp. */
+#define STARTUP_PHASE_MAX (8)
 
 #define SCORE_BASE_SINGLE 10	/* Base score for clearing a single row.		*/
 #define SCORE_BASE_DOUBLE 20	/* Base score for clearing two rows.			*/
@@ -43,6 +44,10 @@ typedef struct {
 extern tetris_shape_info_t g_tetris_shape_table[];
 extern int g_tetris_colors[];
 
+typedef struct tetris_bot_link tetris_bot_link_t;
+typedef struct tetris_beambot tetris_beambot_t;
+typedef struct tetris_term tetris_term_t;
+typedef struct tetris_effects tetris_effects_t;
 typedef struct SDL_Window SDL_Window;
 typedef struct SDL_Renderer SDL_Renderer;
 typedef struct SDL_Texture SDL_Texture;
@@ -73,31 +78,100 @@ typedef struct {
     tetris_shape_kind_t shape;
     int x, y;
     int w, h;
+    int rotation;
     int *draw_data;
 } tetris_piece_t;
 
+/**
+ * Rows are reached through a ring of row pointers, so clearing a line moves
+ * pointers instead of cells and the cleared row is recycled at the top; no
+ * row is ever allocated or freed. A clear moves the pointers on whichever
+ * side of the cleared row is shorter, rotating the ring when it lifts the
+ * rows below, so clears near the floor of a tall board stay cheap. It is not
+ * O(cleared rows) for rows in the middle of the board: O(1) access to any
+ * row rules that out. Boards own their storage: create them with
+ * board_create and copy them with board_copy.
+ */
 typedef struct {
-    int cells[BOARD_SIZE];
+    int rows;				/* Margin rows included.			*/
+    int *storage;			/* rows * BOARD_COLUMNS cells.		*/
+    int **table;			/* 2 * rows pointers, second half mirrors the first.	*/
+    int base;				/* Ring slot of row 0.				*/
+    int **row;				/* table + base: row[y] points into storage.	*/
     tetris_piece_t *current_piece;
 } tetris_board_t;
 
 typedef enum {
     EVENT_KEYDOWN,
+    EVENT_KEYUP,
     EVENT_FOCUS_LOST,
     EVENT_FOCUS_REGAIN
 } tetris_event_kind_t;
 
 typedef struct {
     int64_t data;
+    uint64_t timestamp;		/* SDL_GetTicks time at which the event happened.	*/
+    bool repeat;			/* Generated by OS key repeat.						*/
     tetris_event_kind_t kind;
 } tetris_event_t;
 
+/* Delayed auto shift state for the left/right keys. */
+typedef struct {
+    bool left_down, right_down;
+    int direction;			/* -1, 0 or 1: the held key that is currently shifting.	*/
+    uint64_t pressed_at;	/* When that key went down, or took over from the other.	*/
+    int repeats;			/* Auto-repeat shifts already applied for this press.		*/
+} tetris_shift_state_t;
+
 typedef struct {
     int pieces_spawned, lines_cleared;
     uint64_t start_time, end_time;
 } tetris_stats_t;
 
 typedef struct {
+    uint64_t spawn_time;
+    int inputs, rotations;
+} tetris_piece_metrics_t;
+
+typedef struct {
+    bool startup_report;
+    const char *telemetry_path;
+    int das_ms, arr_ms;
+    const char *bot_command;	/* External bot to spawn, run through the shell.	*/
+    bool bot_binary;			/* Framed binary protocol instead of text lines.	*/
+    int bot_budget_ms;			/* Time the bot gets to answer each move.			*/
+    bool beam_bot;				/* Let the built-in beam search bot play.			*/
+    int beam_width;
+    int beam_lookahead;			/* Queue pieces the beam bot looks at.				*/
+    int board_rows;				/* Board height, margin rows included.				*/
+    bool terminal;				/* Draw to the terminal instead of opening a window.	*/
+    int threads;				/* Worker threads for parallel tools, 0 for one per CPU. */
+    const char *video_input;	/* Telemetry log to replay into a video.			*/
+    const char *video_output;	/* Y4M destination, "-" for stdout.				*/
+    uint32_t video_game;		/* Game id inside the log, 0 for the first one.	*/
+    int video_fps, video_width, video_height;
+    const char *solve_queue;	/* Piece letters to run the solver on.			*/
+    const char *solve_board;	/* Optional starting board for the solver.		*/
+    const char *solve_goal;		/* lines, score or pc.							*/
+    const char *dataset_output;	/* Where to write a training dataset.			*/
+    int dataset_samples;
+    int env_games;				/* Games for the batched environment benchmark.	*/
+    int env_steps;
+} tetris_options_t;
+
+typedef struct {
+    const char *name;
+    double seconds;
+} tetris_startup_phase_t;
+
+typedef struct {
+    tetris_startup_phase_t phases[STARTUP_PHASE_MAX];
+    int phase_count;
+    uint64_t begin, last;
+    bool enabled, printed;
+} tetris_startup_report_t;
+
+typedef struct tetris_context {
 	int w_height, w_width;
 	SDL_Window* window;
 	SDL_Renderer* renderer;
@@ -106,6 +180,7 @@ typedef struct {
 	tetris_event_t event_stack[EVENT_STACK_SIZE];
 	int event_stack_top;
 	tetris_board_t board;
+	tetris_shape_kind_t next_pieces[PIECE_QUEUE_SIZE];
 	double last_frame_duration;
 	double last_delta_time;
 	uint64_t last_time;
@@ -113,7 +188,24 @@ typedef struct {
 	unsigned int score;
 	tetris_stats_t stats;
 	TTF_Font* font;
+    bool font_attempted;
     bool paused;
+    bool auto_paused;		/* Paused because the window lost focus.			*/
+    bool needs_redraw;		/* Something visible changed since the last present.	*/
+    uint32_t game_id;
+    tetris_piece_metrics_t piece_metrics;
+    tetris_shift_state_t shift;
+    tetris_telemetry_t *telemetry;
+    tetris_bot_link_t *bot;
+    tetris_beambot_t *beambot;
+    tetris_term_t *term;
+    tetris_effects_t *effects;	/* Line clear and lock animations, SDL frontend only.	*/
+    /* Frontend: SDL window or terminal. */
+    int (*collect_events)(struct tetris_context *ctx);
+    int (*draw)(struct tetris_context *ctx);
+    uint32_t bot_moves;		/* Move ids handed to the bot so far.				*/
+    tetris_options_t options;
+    tetris_startup_report_t startup;
 } tetris_context_t;
 
 typedef int (*game_loop_fn_t)(tetris_context_t *);
@@ -131,24 +223,64 @@ int set_draw_color(SDL_Renderer *renderer, uint32_t color);
 
 int darken_color(uint32_t color, double amount);
 
+void board_layout_size(int output_height, int rows, double *width, double *height);
+
+void query_board_size(tetris_context_t *ctx, double *width, double *height);
+
 int game_draw(tetris_context_t *ctx);
 
+double fall_time_for_score(unsigned int score);
+
 double game_get_piece_fall_time(tetris_context_t* ctx);
 
+unsigned int score_for_clears(unsigned int score, int clears);
+
 int board_get_cell(const tetris_board_t *board, int x, int y);
 
+int board_stack_height(const tetris_board_t *board);
+
 void board_spawn_piece(tetris_context_t *ctx);
 
+/* Usual single letter names, in tetris_shape_kind_t order: JLIOSTZ. */
+char shape_letter(tetris_shape_kind_t shape);
+
+tetris_shape_kind_t shape_from_letter(char letter);
+
+void shape_rotate(tetris_shape_kind_t shape, int rotation, int *cells, int *w, int *h);
+
+int board_create(tetris_board_t *board, int rows);
+
+/* dst must have been created with the same number of rows. */
+void board_copy(tetris_board_t *dst, const tetris_board_t *src);
+
+void board_destroy(tetris_board_t *board);
+
+void board_initialize(tetris_board_t *board);
+
 void board_fixate_current_piece(tetris_board_t *board);
 
+/**
+ * Removes the full rows among count rows starting at first. Returns how many
+ * were removed. Their indices, top down, go to cleared unless it is NULL.
+ */
+int board_clear_full_rows(tetris_board_t *board, int first, int count, int *cleared);
+
 void board_check_for_clears(tetris_context_t *ctx);
 
+void options_init(tetris_options_t *options);
+
+void startup_mark(tetris_startup_report_t *report, const char *phase);
+
+void startup_print(tetris_startup_report_t *report);
+
+int game_push_event(tetris_context_t *ctx, tetris_event_kind_t kind, int64_t data, uint64_t timestamp, bool repeat);
+
 int game_collect_events(tetris_context_t *ctx);
 
 int game_run(tetris_context_t *ctx, game_loop_fn_t game_update);
 
 void context_destroy(tetris_context_t *ctx);
 
-tetris_context_t *context_create(void);
+tetris_context_t *context_create(const tetris_options_t *options);
 
 void context_reset(tetris_context_t *ctx);
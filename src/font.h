@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdint.h>
+
+/* Built-in 5x7 pixel font. The data lives in font_data.c, which is generated by
+ * tools/gen_font.py; both tables below are produced from the same glyphs. */
+
+#define FONT_GLYPH_WIDTH (5)
+#define FONT_GLYPH_HEIGHT (7)
+#define FONT_FIRST_CHAR (0x20)
+#define FONT_GLYPH_COUNT (95)
+
+/* One byte per glyph row, most significant of the low five bits is the leftmost pixel. */
+extern const uint8_t g_font_glyphs[FONT_GLYPH_COUNT][FONT_GLYPH_HEIGHT];
+
+/* The same glyphs as a TrueType font, meant to be opened through SDL_RWFromConstMem. */
+extern const unsigned char g_font_ttf[];
+extern const unsigned int g_font_ttf_size;
@@ -0,0 +1,852 @@
+/* Generated by tools/gen_font.py. Do not edit. */
+
+#include "font.h"
+
+const uint8_t g_font_glyphs[FONT_GLYPH_COUNT][FONT_GLYPH_HEIGHT] = {
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* ' ' */
+        {0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04}, /* '!' */
+        {0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00}, /* '"' */
+        {0x0a, 0x1f, 0x0a, 0x0a, 0x0a, 0x1f, 0x0a}, /* '#' */
+        {0x04, 0x0f, 0x14, 0x0e, 0x05, 0x1e, 0x04}, /* '$' */
+        {0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03}, /* '%' */
+        {0x08, 0x14, 0x14, 0x08, 0x15, 0x12, 0x0d}, /* '&' */
+        {0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00}, /* '\'' */
+        {0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02}, /* '(' */
+        {0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08}, /* ')' */
+        {0x00, 0x04, 0x15, 0x0e, 0x15, 0x04, 0x00}, /* '*' */
+        {0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00}, /* '+' */
+        {0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x08}, /* ',' */
+        {0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00}, /* '-' */
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c}, /* '.' */
+        {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00}, /* '/' */
+        {0x0e, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0e}, /* '0' */
+        {0x04, 0x0c, 0x04, 0x04, 0x04, 0x04, 0x0e}, /* '1' */
+        {0x0e, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1f}, /* '2' */
+        {0x1f, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0e}, /* '3' */
+        {0x02, 0x06, 0x0a, 0x12, 0x1f, 0x02, 0x02}, /* '4' */
+        {0x1f, 0x10, 0x1e, 0x01, 0x01, 0x11, 0x0e}, /* '5' */
+        {0x06, 0x08, 0x10, 0x1e, 0x11, 0x11, 0x0e}, /* '6' */
+        {0x1f, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08}, /* '7' */
+        {0x0e, 0x11, 0x11, 0x0e, 0x11, 0x11, 0x0e}, /* '8' */
+        {0x0e, 0x11, 0x11, 0x0f, 0x01, 0x02, 0x0c}, /* '9' */
+        {0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00}, /* ':' */
+        {0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x04, 0x08}, /* ';' */
+        {0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02}, /* '<' */
+        {0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00}, /* '=' */
+        {0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08}, /* '>' */
+        {0x0e, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}, /* '?' */
+        {0x0e, 0x11, 0x01, 0x0d, 0x15, 0x15, 0x0e}, /* '@' */
+        {0x0e, 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11}, /* 'A' */
+        {0x1e, 0x11, 0x11, 0x1e, 0x11, 0x11, 0x1e}, /* 'B' */
+        {0x0e, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0e}, /* 'C' */
+        {0x1c, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1c}, /* 'D' */
+        {0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x1f}, /* 'E' */
+        {0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x10}, /* 'F' */
+        {0x0e, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0f}, /* 'G' */
+        {0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11}, /* 'H' */
+        {0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e}, /* 'I' */
+        {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0c}, /* 'J' */
+        {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11}, /* 'K' */
+        {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f}, /* 'L' */
+        {0x11, 0x1b, 0x15, 0x15, 0x11, 0x11, 0x11}, /* 'M' */
+        {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11}, /* 'N' */
+        {0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e}, /* 'O' */
+        {0x1e, 0x11, 0x11, 0x1e, 0x10, 0x10, 0x10}, /* 'P' */
+        {0x0e, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0d}, /* 'Q' */
+        {0x1e, 0x11, 0x11, 0x1e, 0x14, 0x12, 0x11}, /* 'R' */
+        {0x0f, 0x10, 0x10, 0x0e, 0x01, 0x01, 0x1e}, /* 'S' */
+        {0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}, /* 'T' */
+        {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e}, /* 'U' */
+        {0x11, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x04}, /* 'V' */
+        {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0a}, /* 'W' */
+        {0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11}, /* 'X' */
+        {0x11, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04}, /* 'Y' */
+        {0x1f, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1f}, /* 'Z' */
+        {0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e}, /* '[' */
+        {0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00}, /* '\\' */
+        {0x0e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e}, /* ']' */
+        {0x04, 0x0a, 0x11, 0x00, 0x00, 0x00, 0x00}, /* '^' */
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f}, /* '_' */
+        {0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00}, /* '`' */
+        {0x00, 0x00, 0x0e, 0x01, 0x0f, 0x11, 0x0f}, /* 'a' */
+        {0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x1e}, /* 'b' */
+        {0x00, 0x00, 0x0e, 0x10, 0x10, 0x11, 0x0e}, /* 'c' */
+        {0x01, 0x01, 0x0d, 0x13, 0x11, 0x11, 0x0f}, /* 'd' */
+        {0x00, 0x00, 0x0e, 0x11, 0x1f, 0x10, 0x0e}, /* 'e' */
+        {0x06, 0x09, 0x08, 0x1c, 0x08, 0x08, 0x08}, /* 'f' */
+        {0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x0e}, /* 'g' */
+        {0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x11}, /* 'h' */
+        {0x04, 0x00, 0x0c, 0x04, 0x04, 0x04, 0x0e}, /* 'i' */
+        {0x02, 0x00, 0x06, 0x02, 0x02, 0x12, 0x0c}, /* 'j' */
+        {0x10, 0x10, 0x12, 0x14, 0x18, 0x14, 0x12}, /* 'k' */
+        {0x0c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e}, /* 'l' */
+        {0x00, 0x00, 0x1a, 0x15, 0x15, 0x11, 0x11}, /* 'm' */
+        {0x00, 0x00, 0x16, 0x19, 0x11, 0x11, 0x11}, /* 'n' */
+        {0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e}, /* 'o' */
+        {0x00, 0x00, 0x1e, 0x11, 0x1e, 0x10, 0x10}, /* 'p' */
+        {0x00, 0x00, 0x0d, 0x13, 0x0f, 0x01, 0x01}, /* 'q' */
+        {0x00, 0x00, 0x16, 0x19, 0x10, 0x10, 0x10}, /* 'r' */
+        {0x00, 0x00, 0x0f, 0x10, 0x0e, 0x01, 0x1e}, /* 's' */
+        {0x08, 0x08, 0x1c, 0x08, 0x08, 0x09, 0x06}, /* 't' */
+        {0x00, 0x00, 0x11, 0x11, 0x11, 0x13, 0x0d}, /* 'u' */
+        {0x00, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04}, /* 'v' */
+        {0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a}, /* 'w' */
+        {0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11}, /* 'x' */
+        {0x00, 0x00, 0x11, 0x11, 0x0f, 0x01, 0x0e}, /* 'y' */
+        {0x00, 0x00, 0x1f, 0x02, 0x04, 0x08, 0x1f}, /* 'z' */
+        {0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02}, /* '{' */
+        {0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}, /* '|' */
+        {0x08, 0x04, 0x04, 0x02, 0x04, 0x04, 0x08}, /* '}' */
+        {0x00, 0x00, 0x08, 0x15, 0x02, 0x00, 0x00}, /* '~' */
+};
+
+const unsigned char g_font_ttf[] = {
+        0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x80, 0x00, 0x03, 0x00, 0x20, 0x4f, 0x53, 0x2f, 0x32,
+        0x45, 0x00, 0x44, 0x72, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70,
+        0x00, 0x0c, 0x00, 0xd1, 0x00, 0x00, 0x02, 0x4c, 0x00, 0x00, 0x00, 0x34, 0x67, 0x6c, 0x79, 0x66,
+        0x6f, 0x94, 0x17, 0x11, 0x00, 0x00, 0x03, 0x44, 0x00, 0x00, 0x27, 0x0c, 0x68, 0x65, 0x61, 0x64,
+        0x2f, 0x00, 0x7c, 0x8e, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
+        0x05, 0x16, 0x01, 0xf6, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
+        0x06, 0x40, 0x05, 0x14, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x00, 0xc2, 0x6c, 0x6f, 0x63, 0x61,
+        0xd0, 0x72, 0xc6, 0x8d, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x00, 0xc2, 0x6d, 0x61, 0x78, 0x70,
+        0x00, 0x72, 0x00, 0x46, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+        0x8d, 0x30, 0xa4, 0x6d, 0x00, 0x00, 0x2a, 0x50, 0x00, 0x00, 0x00, 0x6f, 0x70, 0x6f, 0x73, 0x74,
+        0x1f, 0x5c, 0xa6, 0x66, 0x00, 0x00, 0x2a, 0xc0, 0x00, 0x00, 0x03, 0xd2, 0x00, 0x01, 0x00, 0x00,
+        0x00, 0x01, 0x00, 0x00, 0xcc, 0xc6, 0x39, 0xc0, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x03, 0x03, 0xe8,
+        0x00, 0x00, 0x00, 0x00, 0xe6, 0xfb, 0x1c, 0x79, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xfb, 0x1c, 0x79,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x20, 0xff, 0x38, 0x00, 0x00, 0x02, 0x58,
+        0x00, 0x00, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x44,
+        0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x58, 0x01, 0x90, 0x00, 0x05,
+        0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x7e, 0x03, 0x20, 0xff, 0x38,
+        0x00, 0x00, 0x03, 0x20, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+        0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x64, 0x00, 0x64,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x64, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x64, 0x00, 0xc8, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+        0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14,
+        0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7e,
+        0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0xff, 0xe1, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x44, 0x00, 0x8e, 0x00, 0xc8, 0x00, 0xff,
+        0x01, 0x4c, 0x01, 0x5e, 0x01, 0x8b, 0x01, 0xb7, 0x01, 0xf0, 0x02, 0x14, 0x02, 0x2b, 0x02, 0x37,
+        0x02, 0x48, 0x02, 0x6b, 0x02, 0xbb, 0x02, 0xe9, 0x03, 0x1d, 0x03, 0x50, 0x03, 0x8a, 0x03, 0xbf,
+        0x03, 0xfa, 0x04, 0x27, 0x04, 0x6f, 0x04, 0xaa, 0x04, 0xc7, 0x04, 0xe9, 0x05, 0x15, 0x05, 0x28,
+        0x05, 0x54, 0x05, 0x82, 0x05, 0xd1, 0x06, 0x1e, 0x06, 0x65, 0x06, 0xa0, 0x06, 0xeb, 0x07, 0x1a,
+        0x07, 0x49, 0x07, 0x90, 0x07, 0xe1, 0x08, 0x0f, 0x08, 0x43, 0x08, 0x91, 0x08, 0xbe, 0x09, 0x1d,
+        0x09, 0x77, 0x09, 0xc4, 0x09, 0xff, 0x0a, 0x54, 0x0a, 0x9f, 0x0a, 0xce, 0x0a, 0xfc, 0x0b, 0x4d,
+        0x0b, 0x9d, 0x0c, 0x00, 0x0c, 0x4f, 0x0c, 0x93, 0x0c, 0xc1, 0x0c, 0xf0, 0x0d, 0x10, 0x0d, 0x3f,
+        0x0d, 0x61, 0x0d, 0x6c, 0x0d, 0x7d, 0x0d, 0xa7, 0x0d, 0xeb, 0x0e, 0x15, 0x0e, 0x5b, 0x0e, 0x85,
+        0x0e, 0xb9, 0x0e, 0xef, 0x0f, 0x38, 0x0f, 0x60, 0x0f, 0x8e, 0x0f, 0xd0, 0x0f, 0xfe, 0x10, 0x46,
+        0x10, 0x84, 0x10, 0xba, 0x10, 0xe4, 0x11, 0x12, 0x11, 0x3f, 0x11, 0x63, 0x11, 0x96, 0x11, 0xd4,
+        0x12, 0x0d, 0x12, 0x55, 0x12, 0x8d, 0x12, 0xbc, 0x12, 0xdf, 0x13, 0x0c, 0x13, 0x39, 0x13, 0x65,
+        0x13, 0x86, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc8, 0x00, 0x00, 0x01, 0x2c, 0x02, 0xbc, 0x00, 0x03,
+        0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0xc8, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0xc8, 0x64, 0x64, 0x00, 0x00, 0x04, 0x00, 0x64, 0x01, 0xf4, 0x01, 0x90, 0x02, 0xbc, 0x00, 0x03,
+        0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x64, 0x64, 0x64, 0x64, 0xfe, 0xd4, 0x64, 0x64,
+        0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x0c, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+        0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x00,
+        0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x64, 0x64, 0x64, 0x64, 0xfe, 0x70, 0x01, 0xf4, 0xfe, 0x70, 0x64, 0x64, 0x64, 0xfe, 0xd4, 0x64,
+        0x64, 0x64, 0xfe, 0xd4, 0x64, 0x64, 0x64, 0xfe, 0x70, 0x01, 0xf4, 0xfe, 0x70, 0x64, 0x64, 0x64,
+        0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+        0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x13, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x21, 0x15, 0x07, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0xc8, 0x64, 0xc8, 0x01, 0x90, 0xfe, 0x0c, 0x64, 0x64, 0x64, 0xc8, 0x01, 0x2c, 0xc8,
+        0x64, 0x64, 0x64, 0xfe, 0x0c, 0x01, 0x90, 0xc8, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03,
+        0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23,
+        0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x33, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0xc8, 0xc8, 0xc8, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc8,
+        0x64, 0xc8, 0x64, 0xc8, 0xc8, 0xc8, 0xc8, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27,
+        0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x64, 0x64, 0xc8, 0x64,
+        0x64, 0x64, 0xfe, 0xd4, 0x64, 0x64, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0x64, 0x64, 0x64, 0x64, 0xfe,
+        0x0c, 0x64, 0xc8, 0x64, 0xfe, 0xd4, 0xc8, 0x64, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x02, 0x00, 0xc8,
+        0x01, 0xf4, 0x01, 0x2c, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0xc8, 0x64, 0x64, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00,
+        0x00, 0x07, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+        0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x15, 0x35,
+        0x33, 0x15, 0x15, 0x35, 0x33, 0x15, 0x01, 0x2c, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x07, 0x00, 0x64, 0x00, 0x00,
+        0x01, 0x90, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
+        0x00, 0x1b, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x15, 0x35, 0x33, 0x15, 0x15, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0x02, 0x58, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x00, 0x09, 0x00, 0x00, 0x00, 0x64, 0x01, 0xf4, 0x02, 0x58, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00,
+        0x13, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0xc8, 0x64, 0xfe, 0xd4, 0x64, 0x64, 0x64, 0x64, 0x64, 0xfe, 0x70, 0x01,
+        0x2c, 0xfe, 0x70, 0x64, 0x64, 0x64, 0x64, 0x64, 0xfe, 0xd4, 0x64, 0x01, 0xf4, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x64, 0x01, 0xf4, 0x02, 0x58, 0x00, 0x03,
+        0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0xc8, 0x64,
+        0x64, 0x64, 0xfe, 0xd4, 0x01, 0xf4, 0xfe, 0xd4, 0x64, 0x64, 0x64, 0x01, 0xf4, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x03, 0x00, 0x64,
+        0x00, 0x00, 0x01, 0x2c, 0x01, 0x2c, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x37, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0xc8, 0x64, 0x64, 0x64, 0xc8, 0x64,
+        0xc8, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x2c,
+        0x01, 0xf4, 0x01, 0x90, 0x00, 0x03, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x01, 0xf4, 0x01, 0x2c,
+        0x64, 0x64, 0x00, 0x02, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x00, 0xc8, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x00, 0x37, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x64, 0xc8, 0xc8, 0xc8, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x00, 0x05, 0x00, 0x00, 0x00, 0x64, 0x01, 0xf4, 0x02, 0x58, 0x00, 0x03,
+        0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x90,
+        0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0x01, 0xf4, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
+        0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x00,
+        0x13, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x21, 0x15, 0x64, 0x01, 0x2c, 0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64,
+        0xc8, 0xc8, 0xfe, 0x0c, 0x64, 0x64, 0x64, 0x64, 0x64, 0xfe, 0x0c, 0xc8, 0xc8, 0x64, 0xfe, 0x0c,
+        0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70, 0x01, 0x2c, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x07, 0x00, 0x64, 0x00, 0x00,
+        0x01, 0x90, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
+        0x00, 0x1b, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x21, 0x15,
+        0xc8, 0x64, 0xc8, 0xc8, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0xc8, 0x01, 0x2c, 0x02,
+        0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc,
+        0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f,
+        0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x21, 0x15, 0x64, 0x01, 0x2c, 0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0x64, 0x64, 0xc8, 0x64, 0xc8,
+        0x64, 0xc8, 0x64, 0xc8, 0x01, 0xf4, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x08,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
+        0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x15, 0x35, 0x33, 0x15, 0x15, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x01, 0xf4, 0xc8, 0x64, 0xc8, 0x64,
+        0x64, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70, 0x01, 0x2c, 0x02, 0x58, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03,
+        0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23,
+        0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x2c, 0x64, 0xc8, 0xc8, 0xfe, 0xd4, 0x64, 0x64, 0x64,
+        0xfe, 0x70, 0x64, 0xc8, 0x64, 0xfe, 0x70, 0x01, 0xf4, 0xc8, 0x64, 0x64, 0x64, 0x02, 0x58, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4,
+        0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b,
+        0x00, 0x1f, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x21, 0x15,
+        0x15, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x21, 0x15, 0x01, 0xf4, 0xfe, 0x0c, 0x64, 0x64, 0x01, 0x90, 0x64, 0x64, 0x64, 0xfe,
+        0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70, 0x01, 0x2c, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00,
+        0x13, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x21, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x21, 0x15, 0xc8, 0xc8, 0xfe, 0xd4, 0x64, 0xc8, 0x64, 0x64, 0x01, 0x90, 0xfe, 0x70,
+        0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70, 0x01, 0x2c, 0x02, 0x58,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4,
+        0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b,
+        0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0xf4,
+        0x64, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0x64, 0x64, 0x64, 0x64, 0x02, 0x58, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27,
+        0x00, 0x2b, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15,
+        0x64, 0x01, 0x2c, 0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe,
+        0x70, 0x01, 0x2c, 0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe,
+        0x70, 0x01, 0x2c, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00,
+        0x13, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x64, 0x01, 0x2c, 0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64,
+        0x01, 0x2c, 0x64, 0xfe, 0x70, 0x01, 0x90, 0x64, 0x64, 0xc8, 0x64, 0xfe, 0xd4, 0xc8, 0x02, 0x58,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x04, 0x00, 0x64, 0x00, 0x64, 0x01, 0x2c,
+        0x02, 0x58, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x64, 0xc8, 0xc8, 0xc8,
+        0xc8, 0xc8, 0xc8, 0xc8, 0x01, 0xf4, 0x64, 0x64, 0x64, 0x64, 0x64, 0xc8, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x00, 0x00, 0x05, 0x00, 0x64, 0x00, 0x00, 0x01, 0x2c, 0x02, 0x58, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x64, 0xc8, 0xc8, 0xc8,
+        0xc8, 0xc8, 0x64, 0x64, 0xc8, 0x64, 0x01, 0xf4, 0x64, 0x64, 0x64, 0x64, 0x64, 0xc8, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x02, 0xbc,
+        0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00,
+        0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x15, 0x35, 0x33, 0x15, 0x15, 0x35, 0x33, 0x15, 0x15, 0x35, 0x33, 0x15, 0x01, 0x2c, 0x64, 0xc8,
+        0x64, 0xc8, 0x64, 0xc8, 0x64, 0x64, 0x64, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x02,
+        0x00, 0x00, 0x00, 0xc8, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x11, 0x35,
+        0x21, 0x15, 0x05, 0x35, 0x21, 0x15, 0x01, 0xf4, 0xfe, 0x0c, 0x01, 0xf4, 0x01, 0x90, 0x64, 0x64,
+        0xc8, 0x64, 0x64, 0x00, 0x00, 0x07, 0x00, 0x64, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03,
+        0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x35,
+        0x33, 0x15, 0x15, 0x35, 0x33, 0x15, 0x15, 0x35, 0x33, 0x15, 0x15, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x64, 0x64, 0x64, 0x64, 0x64, 0xc8,
+        0x64, 0xc8, 0x64, 0xc8, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x07, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+        0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x64, 0x01, 0x2c, 0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0x64, 0x64, 0xc8, 0x64, 0xc8,
+        0x64, 0x64, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0xc8, 0x64, 0x64, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4,
+        0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b,
+        0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x00, 0x13, 0x35,
+        0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x21, 0x15, 0x64, 0x01, 0x2c, 0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0x64, 0x64, 0xfe, 0x70, 0xc8,
+        0x64, 0x64, 0xfe, 0x0c, 0x64, 0x64, 0x64, 0x64, 0x64, 0xfe, 0x0c, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0xfe, 0x70, 0x01, 0x2c, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc,
+        0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f,
+        0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x64, 0x01, 0x2c, 0xfe, 0x70, 0x64,
+        0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe,
+        0x0c, 0x01, 0xf4, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0x02,
+        0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00,
+        0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+        0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b,
+        0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x01, 0x90,
+        0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x01, 0x90,
+        0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x01, 0x90,
+        0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x09,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
+        0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15,
+        0x64, 0x01, 0x2c, 0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70, 0x01, 0x2c, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03,
+        0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23,
+        0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x01, 0x2c, 0xfe, 0xd4, 0x64, 0xc8, 0x64, 0xfe,
+        0x70, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c,
+        0x64, 0xfe, 0x0c, 0x64, 0xc8, 0x64, 0xfe, 0x70, 0x01, 0x2c, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
+        0x00, 0x1b, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x21, 0x15,
+        0x01, 0xf4, 0xfe, 0x0c, 0x64, 0x64, 0x64, 0x64, 0x01, 0x90, 0xfe, 0x70, 0x64, 0x64, 0x64, 0x64,
+        0x01, 0xf4, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4,
+        0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b,
+        0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0xf4,
+        0xfe, 0x0c, 0x64, 0x64, 0x64, 0x64, 0x01, 0x90, 0xfe, 0x70, 0x64, 0x64, 0x64, 0x64, 0x64, 0x02,
+        0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc,
+        0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f,
+        0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x33, 0x35, 0x21, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x21, 0x15, 0x64, 0x01, 0x2c, 0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64,
+        0x64, 0x64, 0x64, 0x01, 0x2c, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c,
+        0x64, 0xfe, 0x70, 0x01, 0x90, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03,
+        0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23,
+        0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x64, 0x01,
+        0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c,
+        0x01, 0xf4, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c,
+        0x64, 0x01, 0x2c, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x07, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x02, 0xbc,
+        0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00,
+        0x13, 0x35, 0x21, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x21, 0x15, 0x64, 0x01, 0x2c, 0xc8,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0xc8, 0x01, 0x2c, 0x02, 0x58, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x35,
+        0x21, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0xc8, 0x01,
+        0x2c, 0xc8, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0xfe, 0x70, 0x64, 0xc8, 0x64, 0xfe, 0xd4,
+        0xc8, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
+        0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x00,
+        0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0xc8, 0x64, 0xfe, 0x70, 0x64,
+        0x64, 0x64, 0xfe, 0xd4, 0xc8, 0xc8, 0x64, 0x64, 0x64, 0xfe, 0xd4, 0x64, 0xc8, 0x64, 0xfe, 0x70,
+        0x64, 0x01, 0x2c, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc,
+        0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00,
+        0x11, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x21, 0x15, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x01, 0xf4, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+        0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b,
+        0x00, 0x2f, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x3f, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x64, 0x01, 0x2c, 0x64,
+        0xfe, 0x0c, 0xc8, 0x64, 0xc8, 0xfe, 0x0c, 0x64, 0x64, 0x64, 0x64, 0x64, 0xfe, 0x0c, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe,
+        0x0c, 0x64, 0x01, 0x2c, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x0f,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
+        0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f,
+        0x00, 0x33, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c,
+        0xc8, 0xc8, 0x64, 0xfe, 0x0c, 0x64, 0x64, 0x64, 0x64, 0x64, 0xfe, 0x0c, 0x64, 0xc8, 0xc8, 0xfe,
+        0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27,
+        0x00, 0x2b, 0x00, 0x2f, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x64, 0x01, 0x2c, 0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0xfe,
+        0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c,
+        0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70, 0x01, 0x2c, 0x02, 0x58, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x09, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+        0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x90,
+        0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x01, 0x90,
+        0xfe, 0x70, 0x64, 0x64, 0x64, 0x64, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27,
+        0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+        0x33, 0x15, 0x64, 0x01, 0x2c, 0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c,
+        0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x64, 0x64, 0x64, 0x64, 0xfe, 0x0c,
+        0x64, 0xc8, 0x64, 0xfe, 0xd4, 0xc8, 0x64, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x0c, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+        0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x00,
+        0x11, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+        0x01, 0x90, 0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c,
+        0x01, 0x90, 0xfe, 0x70, 0x64, 0x64, 0x64, 0xfe, 0xd4, 0x64, 0xc8, 0x64, 0xfe, 0x70, 0x64, 0x01,
+        0x2c, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x15, 0x35, 0x21, 0x15, 0x15, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x64, 0x01, 0x90, 0xfe, 0x0c, 0x64, 0x64, 0x64,
+        0x01, 0x2c, 0x64, 0x64, 0x64, 0xfe, 0x0c, 0x01, 0x90, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00,
+        0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+        0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0xf4, 0xfe, 0xd4, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x0d, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+        0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33,
+        0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64,
+        0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01,
+        0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70, 0x01, 0x2c, 0x02, 0x58, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x0d,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
+        0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f,
+        0x00, 0x33, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01,
+        0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c,
+        0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70, 0x64, 0x64, 0x64, 0xc8, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x11,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
+        0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f,
+        0x00, 0x33, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x3f, 0x00, 0x43, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64,
+        0xfe, 0x0c, 0x64, 0x64, 0x64, 0x64, 0x64, 0xfe, 0x0c, 0x64, 0x64, 0x64, 0x64, 0x64, 0xfe, 0x0c,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0xfe, 0x70, 0x64, 0x64, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03,
+        0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23,
+        0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x64, 0x01,
+        0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70, 0x64, 0x64, 0x64, 0xc8, 0x64, 0xc8,
+        0x64, 0x64, 0x64, 0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0x02,
+        0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27,
+        0x00, 0x2b, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64,
+        0xfe, 0x70, 0x64, 0x64, 0x64, 0xc8, 0x64, 0x64, 0x64, 0x64, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
+        0x00, 0x1b, 0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x21, 0x15,
+        0x01, 0xf4, 0x64, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0x64, 0x01, 0xf4, 0x02,
+        0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x07, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x02, 0xbc,
+        0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00,
+        0x13, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x21, 0x15, 0x64, 0x01, 0x2c, 0xfe,
+        0xd4, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x01, 0x2c, 0x02, 0x58, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x64, 0x01, 0xf4, 0x02, 0x58, 0x00, 0x03,
+        0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x15, 0x35,
+        0x33, 0x15, 0x15, 0x35, 0x33, 0x15, 0x15, 0x35, 0x33, 0x15, 0x15, 0x35, 0x33, 0x15, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x01, 0xf4, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x00, 0x00, 0x07, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x02, 0xbc, 0x00, 0x03,
+        0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x35,
+        0x21, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x64, 0x01, 0x2c, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0xfe, 0xd4, 0x01, 0x2c, 0x02, 0x58, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x90, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0xc8, 0x64, 0xc8, 0x64,
+        0x64, 0x64, 0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x64,
+        0x00, 0x03, 0x00, 0x00, 0x31, 0x35, 0x21, 0x15, 0x01, 0xf4, 0x64, 0x64, 0x00, 0x02, 0x00, 0x64,
+        0x01, 0xf4, 0x01, 0x2c, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+        0x15, 0x35, 0x33, 0x15, 0x64, 0x64, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x06,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
+        0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x15, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x64, 0x01,
+        0x2c, 0x64, 0xfe, 0x70, 0x01, 0x90, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70, 0x01, 0x90,
+        0x01, 0x90, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27,
+        0x00, 0x2b, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0xc8, 0xfe, 0x70, 0xc8, 0xc8, 0x64, 0xfe, 0x0c, 0x64, 0x01,
+        0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x01, 0x90, 0x02, 0x58, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
+        0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x64, 0x01, 0x2c, 0xfe, 0x70, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70, 0x01, 0x2c, 0x01, 0x90, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x0b,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
+        0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x00,
+        0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x01, 0x90, 0x64, 0x64,
+        0x64, 0xfe, 0x70, 0xc8, 0x64, 0x64, 0xfe, 0x0c, 0x64, 0xc8, 0xc8, 0xfe, 0x0c, 0x64, 0x01, 0x2c,
+        0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70, 0x01, 0x90, 0x02, 0x58, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
+        0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x15, 0x35, 0x21, 0x15, 0x64, 0x01, 0x2c, 0xfe, 0x70, 0x64,
+        0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x01, 0xf4, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x01, 0x90, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x08,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
+        0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x21, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0xc8, 0xc8, 0xfe, 0xd4, 0x64, 0xc8,
+        0x64, 0xfe, 0x70, 0x64, 0xc8, 0x01, 0x2c, 0xc8, 0x64, 0x64, 0x64, 0x64, 0x64, 0x02, 0x58, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0x58,
+        0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f,
+        0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x21, 0x15, 0x64, 0x01, 0x90, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c,
+        0x64, 0xfe, 0x70, 0x01, 0x90, 0x64, 0x64, 0xfe, 0x70, 0x01, 0x2c, 0x01, 0xf4, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27,
+        0x00, 0x2b, 0x00, 0x2f, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0xc8, 0xfe, 0x70, 0xc8,
+        0xc8, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c,
+        0x64, 0x01, 0x2c, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x00, 0x06, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x02, 0xbc, 0x00, 0x03,
+        0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x21, 0x15, 0xc8, 0x64, 0xc8, 0xc8, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0xc8, 0x01,
+        0x2c, 0x02, 0x58, 0x64, 0x64, 0xc8, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x02, 0xbc, 0x00, 0x03,
+        0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x2c, 0x64, 0xc8, 0xc8, 0x64,
+        0x64, 0x64, 0x64, 0xfe, 0x70, 0x64, 0xc8, 0x64, 0xfe, 0xd4, 0xc8, 0x02, 0x58, 0x64, 0x64, 0xc8,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+        0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b,
+        0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x33, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0xc8, 0x64, 0xfe, 0x70, 0x64, 0x64, 0x64, 0xfe, 0xd4, 0xc8, 0xc8, 0x64, 0x64,
+        0x64, 0xfe, 0xd4, 0x64, 0xc8, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x00, 0x07, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x02, 0xbc, 0x00, 0x03,
+        0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x21, 0x15, 0x64, 0xc8, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0xc8, 0x01, 0x2c, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00,
+        0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+        0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b,
+        0x00, 0x2f, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0xc8, 0x64, 0x64, 0xfe, 0x70, 0x64, 0x64, 0x64, 0x64, 0x64, 0xfe, 0x0c,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c,
+        0x64, 0x01, 0x90, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00,
+        0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+        0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00,
+        0x11, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x64, 0x64, 0xc8, 0xfe, 0x70, 0xc8, 0xc8, 0x64,
+        0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01,
+        0x2c, 0x64, 0x01, 0x90, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x08, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+        0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x64, 0x01, 0x2c, 0xfe, 0x70, 0x64, 0x01, 0x2c,
+        0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70, 0x01,
+        0x2c, 0x01, 0x90, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4,
+        0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00,
+        0x11, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x90, 0xfe, 0x70, 0x64, 0x01, 0x2c, 0x64,
+        0xfe, 0x0c, 0x01, 0x90, 0xfe, 0x70, 0x64, 0x64, 0x64, 0x01, 0x90, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x07, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+        0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x64, 0xc8, 0x64, 0x64, 0xfe, 0x0c, 0x64, 0xc8, 0xc8, 0xfe, 0x70, 0x01, 0x90, 0x64,
+        0x64, 0x64, 0x64, 0x01, 0x90, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4,
+        0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b,
+        0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x64, 0x64,
+        0xc8, 0xfe, 0x70, 0xc8, 0xc8, 0x64, 0xfe, 0x0c, 0x64, 0x64, 0x64, 0x64, 0x64, 0x01, 0x90, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x13, 0x35, 0x21, 0x15, 0x05, 0x35, 0x33, 0x15,
+        0x15, 0x35, 0x21, 0x15, 0x15, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x64, 0x01, 0x90, 0xfe,
+        0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x01, 0x90, 0x01, 0x90, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0xf4, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
+        0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x21, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x33, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x64, 0x64, 0x64, 0x64, 0xc8, 0x01, 0x2c, 0xc8, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0xc8, 0x64, 0xfe, 0xd4, 0xc8, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b,
+        0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00,
+        0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01,
+        0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0xc8, 0xc8, 0xfe, 0x70, 0xc8,
+        0x64, 0x64, 0x01, 0x90, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x09, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+        0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x64, 0x01,
+        0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70,
+        0x64, 0x64, 0x64, 0xc8, 0x64, 0x01, 0x90, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x0c,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
+        0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f,
+        0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+        0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+        0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+        0x33, 0x15, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0xfe, 0x0c, 0x64, 0x64, 0x64, 0x64, 0x64, 0xfe, 0x70, 0x64, 0x64, 0x64, 0x01,
+        0x90, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x09,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
+        0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15,
+        0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+        0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70, 0x64, 0x64, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0x64, 0x64, 0xfe,
+        0x70, 0x64, 0x01, 0x2c, 0x64, 0x01, 0x90, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x07,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
+        0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x21, 0x15, 0x07, 0x35, 0x33, 0x15,
+        0x05, 0x35, 0x21, 0x15, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x0c, 0x64, 0x01, 0x2c, 0x64, 0xfe, 0x70,
+        0x01, 0x90, 0x64, 0x64, 0xfe, 0x70, 0x01, 0x2c, 0x01, 0x90, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x05, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+        0x00, 0x00, 0x11, 0x35, 0x21, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x21, 0x15, 0x01, 0xf4, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x64, 0xc8, 0x01,
+        0xf4, 0x01, 0x90, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x00, 0x00, 0x07, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07,
+        0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x15, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x15, 0x35, 0x33, 0x15, 0x01, 0x2c, 0x64, 0xc8, 0x64, 0x64, 0x64, 0xc8,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x00, 0x07, 0x00, 0xc8,
+        0x00, 0x00, 0x01, 0x2c, 0x02, 0xbc, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
+        0x00, 0x17, 0x00, 0x1b, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+        0x33, 0x15, 0xc8, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x07, 0x00, 0x64, 0x00, 0x00, 0x01, 0x90, 0x02, 0xbc,
+        0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x00,
+        0x13, 0x35, 0x33, 0x15, 0x15, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x15, 0x35, 0x33, 0x15,
+        0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0xc8, 0x64, 0x64, 0x64, 0xc8, 0x64, 0x02, 0x58, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x00, 0x05,
+        0x00, 0x00, 0x00, 0xc8, 0x01, 0xf4, 0x01, 0xf4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f,
+        0x00, 0x13, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+        0x33, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x64, 0x64, 0xc8, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0xc8, 0x64, 0x01, 0x90, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+        0x00, 0x00, 0x00, 0x04, 0x00, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0c,
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x03,
+        0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x18, 0x00, 0x13, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+        0x00, 0x02, 0x00, 0x0e, 0x00, 0x2b, 0x54, 0x65, 0x74, 0x72, 0x69, 0x73, 0x20, 0x50, 0x69, 0x78,
+        0x65, 0x6c, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x00, 0x54, 0x00, 0x65, 0x00, 0x74, 0x00,
+        0x72, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x50, 0x00, 0x69, 0x00, 0x78, 0x00, 0x65, 0x00,
+        0x6c, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00,
+        0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0x01, 0x02, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06,
+        0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0a, 0x01, 0x0b, 0x01, 0x0c, 0x01, 0x0d, 0x01, 0x0e,
+        0x01, 0x0f, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x01, 0x16,
+        0x01, 0x17, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x1b, 0x01, 0x1c, 0x01, 0x1d, 0x01, 0x1e,
+        0x01, 0x1f, 0x01, 0x20, 0x01, 0x21, 0x01, 0x22, 0x01, 0x23, 0x01, 0x24, 0x01, 0x25, 0x01, 0x26,
+        0x01, 0x27, 0x01, 0x28, 0x01, 0x29, 0x01, 0x2a, 0x01, 0x2b, 0x01, 0x2c, 0x01, 0x2d, 0x01, 0x2e,
+        0x01, 0x2f, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36,
+        0x01, 0x37, 0x01, 0x38, 0x01, 0x39, 0x01, 0x3a, 0x01, 0x3b, 0x01, 0x3c, 0x01, 0x3d, 0x01, 0x3e,
+        0x01, 0x3f, 0x01, 0x40, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46,
+        0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e,
+        0x01, 0x4f, 0x01, 0x50, 0x01, 0x51, 0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56,
+        0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x5b, 0x01, 0x5c, 0x01, 0x5d, 0x01, 0x5e,
+        0x01, 0x5f, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x32, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x32, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x32, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x32, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x32, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x32, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x32, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x32, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x32, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x32, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x32, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x32, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x32, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x32, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x32, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x33, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x33, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x33, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x33, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x33, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x33, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x33, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x33, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x33, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x33, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x33, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x33, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x33, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x33, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x33, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x33, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x34, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x34, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x34, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x34, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x34, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x34, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x34, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x34, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x34, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x34, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x34, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x34, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x34, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x34, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x34, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x34, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x35, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x35, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x35, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x35, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x35, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x35, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x35, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x35, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x35, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x35, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x35, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x35, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x35, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x35, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x35, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x35, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x36, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x36, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x36, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x36, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x36, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x36, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x36, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x36, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x36, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x36, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x36, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x36, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x36, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x36, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x36, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x36, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x37, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x37, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x37, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x37, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x37, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x37, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x37, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x37, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x37, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x37, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x37, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x37, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x37, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x37, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+        0x37, 0x45, 0x00, 0x00,
+};
+
+const unsigned int g_font_ttf_size = sizeof g_font_ttf;
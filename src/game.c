@@ -1,7 +1,12 @@
 #include "engine.h"
+#include "botproto.h"
+#include "beambot.h"
+#include "term.h"
+#include "effects.h"
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <SDL2/SDL.h>
 
@@ -80,25 +85,29 @@ static int collides_y(const tetris_board_t *board, int y_offset) {
 	return collides;
 }
 
-static void game_move_piece(tetris_context_t *ctx, int axis, int amount) {
+static int game_move_piece(tetris_context_t *ctx, int axis, int amount) {
 	if (ctx->board.current_piece != NULL) {
 		if (axis == AXIS_X) {
 			if (collides_x(&ctx->board, amount) == 0) {
 				ctx->board.current_piece->x += amount;
+				return 1;
 			}
 		} else if (axis == AXIS_Y) {
 			if (collides_y(&ctx->board, amount) == 0) {
 				ctx->board.current_piece->y += amount;
+				return 1;
 			}
 		}
 	}
+
+	return 0;
 }
 
-static void game_rotate_piece(tetris_board_t *board) {
+static int game_rotate_piece(tetris_board_t *board) {
 	tetris_piece_t *piece = board->current_piece;
 
 	if (piece == NULL) {
-		return;
+		return 0;
 	}
 
 	int *buffer = calloc(1, sizeof(int) * piece->w * piece->h);
@@ -129,8 +138,101 @@ static void game_rotate_piece(tetris_board_t *board) {
 		temp = piece->w;
 		piece->w = piece->h;
 		piece->h = temp;
+
+		return 0;
+	}
+
+	free(data);
+	piece->rotation = (piece->rotation + 1) % 4;
+
+	return 1;
+}
+
+/**
+ * Applies the auto-repeat shifts that became due up to the given time.
+ * Shifts are counted from the key press time, so the result does not depend
+ * on where frame boundaries fall. Repeats fall at das, das + arr, das + 2 arr
+ * and so on after the press, but never at the press itself: that shift is the
+ * one game_shift_press already made, so a tap moves exactly one column.
+ */
+static void game_shift_advance(tetris_context_t *ctx, uint64_t now) {
+	tetris_shift_state_t *shift = &ctx->shift;
+	const uint64_t das = (uint64_t) ctx->options.das_ms;
+
+	if (ctx->paused || shift->direction == 0 || now <= shift->pressed_at || now - shift->pressed_at < das) {
+		return;
+	}
+
+	if (ctx->options.arr_ms <= 0) {
+		while (game_move_piece(ctx, AXIS_X, shift->direction));
+		return;
+	}
+
+	/* With no delay the first repeat would land on the press; skip it. */
+	const int due = (int) ((now - shift->pressed_at - das) / (uint64_t) ctx->options.arr_ms) + (das > 0 ? 1 : 0);
+	for (; shift->repeats < due; ++shift->repeats) {
+		game_move_piece(ctx, AXIS_X, shift->direction);
+	}
+}
+
+static void game_shift_press(tetris_context_t *ctx, int direction, uint64_t timestamp) {
+	tetris_shift_state_t *shift = &ctx->shift;
+
+	if (direction < 0) {
+		shift->left_down = true;
 	} else {
-		free(data);
+		shift->right_down = true;
+	}
+
+	/* The most recent key wins and shifts right away. */
+	shift->direction = direction;
+	shift->pressed_at = timestamp;
+	shift->repeats = 0;
+
+	game_move_piece(ctx, AXIS_X, direction);
+	ctx->piece_metrics.inputs += 1;
+}
+
+static void game_shift_release(tetris_context_t *ctx, int direction, uint64_t timestamp) {
+	tetris_shift_state_t *shift = &ctx->shift;
+
+	if (direction < 0) {
+		shift->left_down = false;
+	} else {
+		shift->right_down = false;
+	}
+
+	if (shift->direction != direction) {
+		return;
+	}
+
+	/* Fall back to the other key if it is still held, restarting its delay. */
+	if (shift->left_down || shift->right_down) {
+		shift->direction = shift->left_down ? -1 : 1;
+		shift->pressed_at = timestamp;
+		shift->repeats = 0;
+	} else {
+		shift->direction = 0;
+	}
+}
+
+/* A key held through a pause starts its delay over instead of firing the shifts it missed. */
+static void game_resume(tetris_context_t *ctx, uint64_t timestamp) {
+	ctx->paused = ctx->auto_paused = false;
+	ctx->shift.pressed_at = timestamp;
+	ctx->shift.repeats = 0;
+}
+
+static int horizontal_direction(int64_t key) {
+	switch (key) {
+		case SDLK_LEFT:
+		case SDLK_a:
+			return -1;
+		case SDLK_RIGHT:
+		case SDLK_d:
+			return 1;
+		default:
+			return 0;
 	}
 }
 
@@ -138,25 +240,58 @@ static int game_check_input(tetris_context_t *ctx) {
 	int i;
 	for (i = 0; i < ctx->event_stack_top; ++i) {
 		tetris_event_t *ev = &ctx->event_stack[i];
-		if (ev->kind == EVENT_KEYDOWN) {
+
+		ctx->needs_redraw = true;
+
+		if (ev->kind == EVENT_FOCUS_LOST) {
+			if (!ctx->paused) {
+				ctx->paused = ctx->auto_paused = true;
+			}
+			continue;
+		}
+
+		if (ev->kind == EVENT_FOCUS_REGAIN) {
+			/* Only undo our own pause, never one the player asked for. */
+			if (ctx->auto_paused) {
+				game_resume(ctx, ev->timestamp);
+			}
+			continue;
+		}
+
+		game_shift_advance(ctx, ev->timestamp);
+
+		const int direction = horizontal_direction(ev->data);
+
+		if (ev->kind == EVENT_KEYUP) {
+			if (direction != 0) {
+				game_shift_release(ctx, direction, ev->timestamp);
+			}
+		} else if (ev->kind == EVENT_KEYDOWN) {
+			if (direction != 0) {
+				/* Horizontal repeat is handled by DAS/ARR, not by the OS. */
+				if (!ev->repeat) {
+					game_shift_press(ctx, direction, ev->timestamp);
+				}
+				continue;
+			}
+
 			switch (ev->data) {
-				case SDLK_LEFT:
-				case SDLK_a:
-					game_move_piece(ctx, AXIS_X, -1);
-					break;
-				case SDLK_RIGHT:
-				case SDLK_d:
-					game_move_piece(ctx, AXIS_X, 1);
-					break;
 				case SDLK_DOWN:
 				case SDLK_s:
 					game_move_piece(ctx, AXIS_Y, 1);
+					ctx->piece_metrics.inputs += 1;
 					break;
 				case SDLK_r:
-					game_rotate_piece(&ctx->board);
+					ctx->piece_metrics.rotations += game_rotate_piece(&ctx->board);
+					ctx->piece_metrics.inputs += 1;
 					break;
                 case SDLK_ESCAPE:
-                    ctx->paused = !ctx->paused;
+                    if (ctx->paused) {
+                        game_resume(ctx, ev->timestamp);
+                    } else {
+                        ctx->paused = true;
+                        ctx->auto_paused = false;
+                    }
                     break;
 				default:
 					break;
@@ -165,9 +300,128 @@ static int game_check_input(tetris_context_t *ctx) {
 	}
 	ctx->event_stack_top = 0;
 
+	game_shift_advance(ctx, SDL_GetTicks());
+
 	return 0;
 }
 
+static void game_record_piece(tetris_context_t *ctx, unsigned int score_before, int lines_before) {
+	const tetris_piece_t *piece = ctx->board.current_piece;
+
+	if (ctx->telemetry == NULL || piece == NULL) {
+		return;
+	}
+
+	tetris_telemetry_record_t record = {0};
+	record.spawn_time_ms = ctx->piece_metrics.spawn_time;
+	record.lock_time_ms = SDL_GetTicks() - ctx->stats.start_time;
+	record.game_id = ctx->game_id;
+	record.piece_index = ctx->stats.pieces_spawned - 1;
+	record.score_delta = ctx->score - score_before;
+	record.color = piece->color;
+	record.inputs = ctx->piece_metrics.inputs;
+	record.rotations = ctx->piece_metrics.rotations;
+	record.rows_cleared = ctx->stats.lines_cleared - lines_before;
+	record.stack_height = board_stack_height(&ctx->board);
+	record.shape = piece->shape;
+	record.orientation = piece->rotation;
+	record.x = piece->x;
+	record.y = piece->y;
+
+	telemetry_record(ctx->telemetry, &record);
+}
+
+/**
+ * Pushes a key press onto the event stack as if it came from the keyboard,
+ * so bot moves go through exactly the same handling as the player's.
+ */
+static int game_push_key(tetris_context_t *ctx, int64_t key, uint64_t timestamp) {
+	int status_code;
+
+	if ((status_code = game_push_event(ctx, EVENT_KEYDOWN, key, timestamp, false)) != 0) {
+		return status_code;
+	}
+
+	return game_push_event(ctx, EVENT_KEYUP, key, timestamp, false);
+}
+
+/* Queues the keys that rotate the current piece, slide it to column x and drop it. */
+static void game_push_placement(tetris_context_t *ctx, int rotation, int x, uint64_t now) {
+	const int shift = x - ctx->board.current_piece->x;
+	const int64_t key = shift < 0 ? SDLK_LEFT : SDLK_RIGHT;
+	int i, status_code = 0;
+
+	for (i = 0; i < rotation % 4 && status_code == 0; ++i) {
+		status_code = game_push_key(ctx, SDLK_r, now);
+	}
+
+	for (i = 0; i < abs(shift) && status_code == 0; ++i) {
+		status_code = game_push_key(ctx, key, now);
+	}
+
+	for (i = 0; i < ctx->board.rows && status_code == 0; ++i) {
+		status_code = game_push_event(ctx, EVENT_KEYDOWN, SDLK_DOWN, now, false);
+	}
+}
+
+static void game_beambot_move(tetris_context_t *ctx) {
+	tetris_shape_kind_t pieces[PIECE_QUEUE_SIZE + 1];
+	pieces[0] = ctx->board.current_piece->shape;
+	memcpy(pieces + 1, ctx->next_pieces, sizeof(ctx->next_pieces));
+
+	tetris_bitboard_t board;
+	bitboard_from_board(&board, &ctx->board);
+
+	/* Never think for longer than it takes the piece to fall one row. */
+	const uint64_t now = SDL_GetTicks();
+	const uint64_t deadline = now + (uint64_t) (game_get_piece_fall_time(ctx) * 1000.0);
+
+	tetris_placement_t placement;
+	if (beambot_search(ctx->beambot, &board, pieces, PIECE_QUEUE_SIZE + 1, deadline, &placement)) {
+		game_push_placement(ctx, placement.rotation, placement.x, now);
+	}
+}
+
+static void game_bot_move(tetris_context_t *ctx) {
+	const tetris_piece_t *piece = ctx->board.current_piece;
+
+	bot_state_t state;
+	state.move_id = ++ctx->bot_moves;
+	bitboard_from_board(&state.board, &ctx->board);
+	state.current = piece->shape;
+	state.x = piece->x;
+	state.y = piece->y;
+	state.rotation = piece->rotation;
+	state.queue_length = PIECE_QUEUE_SIZE;
+	memcpy(state.queue, ctx->next_pieces, sizeof(state.queue));
+
+	bot_reply_t reply;
+	if (bot_link_request(ctx->bot, &state, &reply) != 0) {
+		puts("Continuing without the external bot");
+		bot_link_close(ctx->bot);
+		ctx->bot = NULL;
+		return;
+	}
+
+	const uint64_t now = SDL_GetTicks();
+	int status_code = 0;
+
+	if (reply.kind == BOT_REPLY_PLACE) {
+		game_push_placement(ctx, reply.rotation, reply.x, now);
+	} else if (reply.kind == BOT_REPLY_KEYS) {
+		const char *key;
+		for (key = reply.keys; *key != 0 && status_code == 0; ++key) {
+			switch (*key) {
+				case 'L': status_code = game_push_key(ctx, SDLK_LEFT, now); break;
+				case 'R': status_code = game_push_key(ctx, SDLK_RIGHT, now); break;
+				case 'D': status_code = game_push_event(ctx, EVENT_KEYDOWN, SDLK_DOWN, now, false); break;
+				case 'C': status_code = game_push_key(ctx, SDLK_r, now); break;
+				default: break;
+			}
+		}
+	}
+}
+
 static void game_reset(tetris_context_t *ctx) {
 	ctx->stats.end_time = SDL_GetTicks();
 
@@ -182,7 +436,11 @@ static void game_reset(tetris_context_t *ctx) {
 
 	snprintf(message, sizeof message, format, (ctx->stats.end_time - ctx->stats.start_time + 0.0) / 1000.0, ctx->stats.lines_cleared, ctx->stats.pieces_spawned);
 
-	SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_INFORMATION, "End", message, ctx->window);
+	if (ctx->term != NULL) {
+		term_show_message(ctx->term, message);
+	} else {
+		SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_INFORMATION, "End", message, ctx->window);
+	}
 
 	context_reset(ctx);
 }
@@ -192,7 +450,14 @@ int game_update(tetris_context_t *ctx) {
     double fall_time;
     
     if (!ctx->paused) {
+        ctx->needs_redraw = true;
         ctx->fall_timer += ctx->last_delta_time;
+
+        /* Animations only ever follow the game, they never hold it back. */
+        if (ctx->effects != NULL) {
+            effects_update(ctx->effects, ctx->last_delta_time);
+        }
+
         fall_time = game_get_piece_fall_time(ctx);
         while(ctx->fall_timer > fall_time)
         {
@@ -201,8 +466,15 @@ int game_update(tetris_context_t *ctx) {
         }
 
         if (ctx->board.current_piece == NULL || collides_y(&ctx->board, 1)) {
+            const unsigned int score_before = ctx->score;
+            const int lines_before = ctx->stats.lines_cleared;
+
             board_fixate_current_piece(&ctx->board);
+            if (ctx->effects != NULL && ctx->board.current_piece != NULL) {
+                effects_lock(ctx->effects, ctx->board.current_piece);
+            }
             board_check_for_clears(ctx);
+            game_record_piece(ctx, score_before, lines_before);
             board_spawn_piece(ctx);
 
             // If after spawning a piece it immediately overlap another piece (in the first row), it's a loss
@@ -210,6 +482,10 @@ int game_update(tetris_context_t *ctx) {
 
             if (collides_y(&ctx->board, 0) || collides_x(&ctx->board, 0)) {
                 game_reset(ctx);
+            } else if (ctx->bot != NULL) {
+                game_bot_move(ctx);
+            } else if (ctx->beambot != NULL) {
+                game_beambot_move(ctx);
             }
         }
     }
@@ -221,10 +497,14 @@ int game_update(tetris_context_t *ctx) {
 	return 0;
 }
 
-int start_game(void) {
+int start_game(const tetris_options_t *options) {
 	int status_code;
 
-	tetris_context_t *ctx = context_create();
+	tetris_context_t *ctx = context_create(options);
+	if (ctx == NULL) {
+		return 1;
+	}
+
 	while ((status_code = game_run(ctx, game_update)) == 0);
 	context_destroy(ctx);
 
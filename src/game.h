@@ -1,3 +1,5 @@
 #pragma once
 
-int start_game(void);
\ No newline at end of file
+#include "engine.h"
+
+int start_game(const tetris_options_t *options);
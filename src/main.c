@@ -1,5 +1,145 @@
 #include "game.h"
+#include "video.h"
+#include "solver.h"
+#include "vecenv.h"
+#include "dataset.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+static void print_usage(const char *program) {
+	printf("Usage: %s [options]\n", program);
+	puts("  --startup-report    Print how long each startup phase took");
+	puts("  --terminal          Play in the terminal with ANSI colors instead of a window");
+	puts("  --rows N            Playable board height, up to 1024 (default 20)");
+	puts("  --das MS            Delay before a held left/right key repeats (default 167)");
+	puts("  --arr MS            Time between repeated shifts, 0 for instant (default 33)");
+	puts("  --bot COMMAND       Let an external program play, talking over its stdin/stdout");
+	puts("  --bot-binary        Use the framed binary bot protocol instead of text lines");
+	puts("  --bot-budget MS     Time the bot gets for each move (default 100)");
+	puts("  --beam-bot          Let the built-in beam search bot play");
+	puts("  --beam-width N      Boards the beam bot keeps per level (default 64)");
+	puts("  --beam-lookahead N  Upcoming pieces the beam bot searches, 0 to 5 (default 2)");
+	puts("  --telemetry FILE    Append per-piece telemetry to FILE");
+	puts("  --telemetry-csv FILE");
+	puts("                      Convert a telemetry log to CSV on stdout and exit");
+	puts("  --export-video FILE Replay a telemetry log as a Y4M video and exit");
+	puts("  --video-out FILE    Where to write the video, - for stdout (default)");
+	puts("  --video-game ID     Game to replay from the log (default: the first one)");
+	puts("  --video-size WxH    Video frame size (default: window size)");
+	puts("  --fps N             Video frame rate");
+	puts("  --solve QUEUE       Find the best placements for a piece queue such as IJLOSTZ and exit");
+	puts("  --solve-board FILE  Starting board for --solve: rows of '.' and '#', bottom aligned");
+	puts("  --solve-goal GOAL   lines (default), score, or pc for a perfect clear");
+	puts("  --export-dataset FILE");
+	puts("                      Let the beam bot play headless games and save every move for training");
+	puts("  --dataset-samples N Moves to save with --export-dataset (default 100000)");
+	puts("  --read-dataset FILE Verify a dataset file and print a summary");
+	puts("  --env-bench GAMES   Step GAMES headless games in lockstep with random moves and report the rate");
+	puts("  --env-steps N       Steps for --env-bench (default 1000)");
+	puts("  --threads N         Worker threads for parallel tools and bots (default: one per CPU)");
+	puts("  --help              Show this message");
+}
 
 int main(int argc, char **argv) {
-	return start_game();
-}
\ No newline at end of file
+	tetris_options_t options;
+	options_init(&options);
+
+	int i;
+	for (i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "--startup-report") == 0) {
+			options.startup_report = true;
+		} else if (strcmp(argv[i], "--terminal") == 0) {
+			options.terminal = true;
+		} else if (strcmp(argv[i], "--rows") == 0 && i + 1 < argc) {
+			options.board_rows = atoi(argv[++i]) + 2;
+		} else if (strcmp(argv[i], "--das") == 0 && i + 1 < argc) {
+			options.das_ms = atoi(argv[++i]);
+			if (options.das_ms < 0) {
+				printf("--das must not be negative: %s\n", argv[i]);
+				print_usage(argv[0]);
+				return 1;
+			}
+		} else if (strcmp(argv[i], "--arr") == 0 && i + 1 < argc) {
+			options.arr_ms = atoi(argv[++i]);
+			if (options.arr_ms < 0) {
+				printf("--arr must not be negative: %s\n", argv[i]);
+				print_usage(argv[0]);
+				return 1;
+			}
+		} else if (strcmp(argv[i], "--bot") == 0 && i + 1 < argc) {
+			options.bot_command = argv[++i];
+		} else if (strcmp(argv[i], "--bot-binary") == 0) {
+			options.bot_binary = true;
+		} else if (strcmp(argv[i], "--bot-budget") == 0 && i + 1 < argc) {
+			options.bot_budget_ms = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--beam-bot") == 0) {
+			options.beam_bot = true;
+		} else if (strcmp(argv[i], "--beam-width") == 0 && i + 1 < argc) {
+			options.beam_width = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--beam-lookahead") == 0 && i + 1 < argc) {
+			options.beam_lookahead = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--telemetry") == 0 && i + 1 < argc) {
+			options.telemetry_path = argv[++i];
+		} else if (strcmp(argv[i], "--telemetry-csv") == 0 && i + 1 < argc) {
+			return telemetry_export_csv(argv[i + 1], stdout);
+		} else if (strcmp(argv[i], "--export-video") == 0 && i + 1 < argc) {
+			options.video_input = argv[++i];
+		} else if (strcmp(argv[i], "--video-out") == 0 && i + 1 < argc) {
+			options.video_output = argv[++i];
+		} else if (strcmp(argv[i], "--video-game") == 0 && i + 1 < argc) {
+			options.video_game = (uint32_t) strtoul(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "--video-size") == 0 && i + 1 < argc) {
+			if (sscanf(argv[++i], "%dx%d", &options.video_width, &options.video_height) != 2) {
+				printf("Invalid size: %s\n", argv[i]);
+				return 1;
+			}
+		} else if (strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+			options.video_fps = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--solve") == 0 && i + 1 < argc) {
+			options.solve_queue = argv[++i];
+		} else if (strcmp(argv[i], "--solve-board") == 0 && i + 1 < argc) {
+			options.solve_board = argv[++i];
+		} else if (strcmp(argv[i], "--solve-goal") == 0 && i + 1 < argc) {
+			options.solve_goal = argv[++i];
+		} else if (strcmp(argv[i], "--export-dataset") == 0 && i + 1 < argc) {
+			options.dataset_output = argv[++i];
+		} else if (strcmp(argv[i], "--dataset-samples") == 0 && i + 1 < argc) {
+			options.dataset_samples = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--read-dataset") == 0 && i + 1 < argc) {
+			return dataset_summary(argv[i + 1]);
+		} else if (strcmp(argv[i], "--env-bench") == 0 && i + 1 < argc) {
+			options.env_games = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--env-steps") == 0 && i + 1 < argc) {
+			options.env_steps = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+			options.threads = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--help") == 0) {
+			print_usage(argv[0]);
+			return 0;
+		} else {
+			printf("Unknown option: %s\n", argv[i]);
+			print_usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (options.video_input != NULL) {
+		return video_export(&options);
+	}
+
+	if (options.solve_queue != NULL) {
+		return solver_main(options.solve_queue, options.solve_board, options.solve_goal, options.threads);
+	}
+
+	if (options.dataset_output != NULL) {
+		return dataset_export(&options);
+	}
+
+	if (options.env_games > 0) {
+		return vecenv_benchmark(options.env_games, options.env_steps > 0 ? options.env_steps : 1000, options.threads);
+	}
+
+	return start_game(&options);
+}
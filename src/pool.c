@@ -0,0 +1,147 @@
+#include "pool.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include <SDL.h>
+
+struct tetris_pool {
+    SDL_Thread **workers;
+    int worker_count;
+
+    SDL_mutex *lock;
+    SDL_cond *start, *done;
+    unsigned int generation;
+    int finished;
+    int quit;
+
+    pool_task_fn_t fn;
+    void *data;
+    int count;
+    SDL_atomic_t next;
+};
+
+static void pool_drain(tetris_pool_t *pool) {
+    int index;
+    while ((index = SDL_AtomicAdd(&pool->next, 1)) < pool->count) {
+        pool->fn(pool->data, index);
+    }
+}
+
+static int pool_worker_main(void *data) {
+    tetris_pool_t *pool = data;
+    unsigned int seen = 0;
+
+    SDL_LockMutex(pool->lock);
+    for (;;) {
+        while (pool->generation == seen && !pool->quit) {
+            SDL_CondWait(pool->start, pool->lock);
+        }
+
+        if (pool->quit) {
+            break;
+        }
+
+        seen = pool->generation;
+        SDL_UnlockMutex(pool->lock);
+
+        pool_drain(pool);
+
+        SDL_LockMutex(pool->lock);
+        if (++pool->finished == pool->worker_count) {
+            SDL_CondSignal(pool->done);
+        }
+    }
+    SDL_UnlockMutex(pool->lock);
+
+    return 0;
+}
+
+tetris_pool_t *pool_create(int threads) {
+    if (threads <= 0) {
+        threads = SDL_GetCPUCount();
+    }
+    if (threads < 1) {
+        threads = 1;
+    }
+
+    tetris_pool_t *pool = calloc(1, sizeof(*pool));
+    if (pool == NULL)
+        return NULL;
+
+    pool->lock = SDL_CreateMutex();
+    pool->start = SDL_CreateCond();
+    pool->done = SDL_CreateCond();
+    pool->workers = calloc(threads, sizeof(*pool->workers));
+
+    if (pool->lock == NULL || pool->start == NULL || pool->done == NULL || pool->workers == NULL) {
+        pool_destroy(pool);
+        return NULL;
+    }
+
+    /* The caller of pool_run is the last worker. */
+    int i;
+    for (i = 0; i < threads - 1; ++i) {
+        pool->workers[i] = SDL_CreateThread(pool_worker_main, "pool", pool);
+        if (pool->workers[i] == NULL) {
+            fprintf(stderr, "Failed to start pool thread: %s\n", SDL_GetError());
+            break;
+        }
+        pool->worker_count += 1;
+    }
+
+    return pool;
+}
+
+int pool_size(const tetris_pool_t *pool) {
+    return pool->worker_count + 1;
+}
+
+void pool_run(tetris_pool_t *pool, int count, pool_task_fn_t fn, void *data) {
+    if (count <= 0) {
+        return;
+    }
+
+    SDL_LockMutex(pool->lock);
+    pool->fn = fn;
+    pool->data = data;
+    pool->count = count;
+    pool->finished = 0;
+    SDL_AtomicSet(&pool->next, 0);
+    pool->generation += 1;
+    SDL_CondBroadcast(pool->start);
+    SDL_UnlockMutex(pool->lock);
+
+    pool_drain(pool);
+
+    SDL_LockMutex(pool->lock);
+    while (pool->finished < pool->worker_count) {
+        SDL_CondWait(pool->done, pool->lock);
+    }
+    SDL_UnlockMutex(pool->lock);
+}
+
+void pool_destroy(tetris_pool_t *pool) {
+    if (pool == NULL) {
+        return;
+    }
+
+    if (pool->lock != NULL) {
+        SDL_LockMutex(pool->lock);
+        pool->quit = 1;
+        SDL_CondBroadcast(pool->start);
+        SDL_UnlockMutex(pool->lock);
+    }
+
+    int i;
+    for (i = 0; i < pool->worker_count; ++i) {
+        SDL_WaitThread(pool->workers[i], NULL);
+    }
+
+    if (pool->done != NULL) SDL_DestroyCond(pool->done);
+    if (pool->start != NULL) SDL_DestroyCond(pool->start);
+    if (pool->lock != NULL) SDL_DestroyMutex(pool->lock);
+
+    free(pool->workers);
+    free(pool);
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+/**
+ * Fixed-size worker pool built on SDL threads. pool_run() is a blocking
+ * parallel for: the calling thread takes part in the work and returns once
+ * every index has been processed.
+ */
+
+typedef struct tetris_pool tetris_pool_t;
+
+typedef void (*pool_task_fn_t)(void *data, int index);
+
+/* A thread count of zero or less uses one thread per CPU. */
+tetris_pool_t *pool_create(int threads);
+
+int pool_size(const tetris_pool_t *pool);
+
+void pool_run(tetris_pool_t *pool, int count, pool_task_fn_t fn, void *data);
+
+void pool_destroy(tetris_pool_t *pool);
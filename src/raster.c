@@ -0,0 +1,196 @@
+#include "raster.h"
+#include "font.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define RASTER_SSE2 1
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+# include <arm_neon.h>
+# define RASTER_NEON 1
+#endif
+
+tetris_raster_t *raster_create(int width, int height) {
+    tetris_raster_t *raster = calloc(1, sizeof(*raster));
+    if (raster == NULL)
+        return NULL;
+
+    raster->pixels = calloc((size_t) width * height, sizeof(*raster->pixels));
+    if (raster->pixels == NULL) {
+        free(raster);
+        return NULL;
+    }
+
+    raster->width = width;
+    raster->height = height;
+
+    return raster;
+}
+
+void raster_destroy(tetris_raster_t *raster) {
+    if (raster != NULL) {
+        free(raster->pixels);
+        free(raster);
+    }
+}
+
+uint32_t raster_pack_color(uint32_t color) {
+    const uint8_t bytes[4] = {(color >> 16) & 0xFF, (color >> 8) & 0xFF, color & 0xFF, 0xFF};
+    uint32_t pixel;
+
+    memcpy(&pixel, bytes, sizeof pixel);
+    return pixel;
+}
+
+static void fill_span(uint32_t *dst, int count, uint32_t pixel) {
+#if defined(RASTER_SSE2)
+    const __m128i value = _mm_set1_epi32((int) pixel);
+    for (; count >= 8; count -= 8, dst += 8) {
+        _mm_storeu_si128((__m128i *) dst, value);
+        _mm_storeu_si128((__m128i *) (dst + 4), value);
+    }
+    for (; count >= 4; count -= 4, dst += 4) {
+        _mm_storeu_si128((__m128i *) dst, value);
+    }
+#elif defined(RASTER_NEON)
+    const uint32x4_t value = vdupq_n_u32(pixel);
+    for (; count >= 4; count -= 4, dst += 4) {
+        vst1q_u32(dst, value);
+    }
+#endif
+    while (count-- > 0) {
+        *dst++ = pixel;
+    }
+}
+
+void raster_clear(tetris_raster_t *raster, uint32_t color) {
+    fill_span(raster->pixels, raster->width * raster->height, raster_pack_color(color));
+}
+
+/* Clips the rectangle against the raster, returning 0 if nothing is left. */
+static int clip_rect(const tetris_raster_t *raster, int *x, int *y, int *w, int *h) {
+    if (*x < 0) { *w += *x; *x = 0; }
+    if (*y < 0) { *h += *y; *y = 0; }
+    if (*x + *w > raster->width) *w = raster->width - *x;
+    if (*y + *h > raster->height) *h = raster->height - *y;
+
+    return *w > 0 && *h > 0;
+}
+
+void raster_fill_rect(tetris_raster_t *raster, int x, int y, int w, int h, uint32_t color) {
+    if (!clip_rect(raster, &x, &y, &w, &h)) {
+        return;
+    }
+
+    const uint32_t pixel = raster_pack_color(color);
+
+    int row;
+    for (row = y; row < y + h; ++row) {
+        fill_span(raster->pixels + (size_t) row * raster->width + x, w, pixel);
+    }
+}
+
+/* One pixel wide outline on the inside of the rectangle, like SDL_RenderDrawRect. */
+void raster_draw_rect(tetris_raster_t *raster, int x, int y, int w, int h, uint32_t color) {
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+
+    raster_fill_rect(raster, x, y, w, 1, color);
+    raster_fill_rect(raster, x, y + h - 1, w, 1, color);
+    raster_fill_rect(raster, x, y + 1, 1, h - 2, color);
+    raster_fill_rect(raster, x + w - 1, y + 1, 1, h - 2, color);
+}
+
+void raster_draw_text(tetris_raster_t *raster, int x, int y, int scale, const char *text, uint32_t color) {
+    for (; *text != 0; ++text, x += (FONT_GLYPH_WIDTH + 1) * scale) {
+        const int index = (unsigned char) *text - FONT_FIRST_CHAR;
+        if (index < 0 || index >= FONT_GLYPH_COUNT) {
+            continue;
+        }
+
+        int row;
+        for (row = 0; row < FONT_GLYPH_HEIGHT; ++row) {
+            const uint8_t bits = g_font_glyphs[index][row];
+
+            /* Runs of set pixels become a single span per scaled row. */
+            int col = 0;
+            while (col < FONT_GLYPH_WIDTH) {
+                if (!(bits & (1 << (FONT_GLYPH_WIDTH - 1 - col)))) {
+                    ++col;
+                    continue;
+                }
+
+                const int start = col;
+                while (col < FONT_GLYPH_WIDTH && (bits & (1 << (FONT_GLYPH_WIDTH - 1 - col)))) {
+                    ++col;
+                }
+
+                raster_fill_rect(raster, x + start * scale, y + row * scale, (col - start) * scale, scale, color);
+            }
+        }
+    }
+}
+
+/* Same look as draw_single_block: a filled cell with a darker outline. */
+void raster_draw_block(tetris_raster_t *raster, int rows, int x, int y, int color) {
+    double bw, bh;
+
+    board_layout_size(raster->height, rows, &bw, &bh);
+
+    const double cell_width = bw / BOARD_COLUMNS;
+    const double cell_height = bh / rows;
+
+    const int x0 = (int) lround(x * cell_width);
+    const int y0 = (int) lround(y * cell_height);
+    const int x1 = (int) lround((x + 1) * cell_width);
+    const int y1 = (int) lround((y + 1) * cell_height);
+
+    raster_fill_rect(raster, x0, y0, x1 - x0, y1 - y0, color);
+    raster_draw_rect(raster, x0, y0, x1 - x0, y1 - y0, darken_color(color, DARK_AMOUNT));
+}
+
+int raster_draw_board(tetris_raster_t *raster, const tetris_board_t *board, unsigned int score) {
+    raster_clear(raster, 0x000000);
+
+    int x, y;
+    for (y = 0; y < board->rows; ++y) {
+        for (x = 0; x < BOARD_COLUMNS; ++x) {
+            raster_draw_block(raster, board->rows, x, y, board_get_cell(board, x, y));
+        }
+    }
+
+    const tetris_piece_t *piece = board->current_piece;
+    if (piece != NULL) {
+        for (y = 0; y < piece->h; ++y) {
+            for (x = 0; x < piece->w; ++x) {
+                if (piece->draw_data[y * piece->w + x]) {
+                    raster_draw_block(raster, board->rows, piece->x + x, piece->y + y, piece->color);
+                }
+            }
+        }
+    }
+
+    /* Mirror draw_text's placement of the score line, scaled with the output height. */
+    double bw;
+    board_layout_size(raster->height, board->rows, &bw, NULL);
+
+    const double ratio = (double) raster->height / W_HEIGHT_DEFAULT;
+    int scale = (int) (FONT_SIZE / 10 * ratio);
+    if (scale < 1) {
+        scale = 1;
+    }
+
+    const int line_height = 10 * scale;
+    const int text_y = (int) (20 * ratio) + (line_height + (int) (10 * ratio)) * 5 + scale;
+
+    char buffer[64];
+    snprintf(buffer, sizeof buffer, "Score: %u", score);
+    raster_draw_text(raster, (int) (bw * 1.15), text_y, scale, buffer, 0xFFFFFF);
+
+    return 0;
+}
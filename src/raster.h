@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "engine.h"
+
+/**
+ * Offscreen software renderer. Draws the same scene as game_draw into a
+ * plain memory buffer, with no window, renderer or SDL initialization.
+ */
+
+typedef struct {
+    int width, height;
+    uint32_t *pixels;	/* RGBA byte order, width pixels per row, no padding. */
+} tetris_raster_t;
+
+tetris_raster_t *raster_create(int width, int height);
+
+void raster_destroy(tetris_raster_t *raster);
+
+/* Converts a 0xRRGGBB color into the raster's pixel format. */
+uint32_t raster_pack_color(uint32_t color);
+
+void raster_clear(tetris_raster_t *raster, uint32_t color);
+
+void raster_fill_rect(tetris_raster_t *raster, int x, int y, int w, int h, uint32_t color);
+
+void raster_draw_rect(tetris_raster_t *raster, int x, int y, int w, int h, uint32_t color);
+
+void raster_draw_text(tetris_raster_t *raster, int x, int y, int scale, const char *text, uint32_t color);
+
+/* Cell (x, y) of a board with the given number of rows. */
+void raster_draw_block(tetris_raster_t *raster, int rows, int x, int y, int color);
+
+/* Board, falling piece and score, laid out like the window. */
+int raster_draw_board(tetris_raster_t *raster, const tetris_board_t *board, unsigned int score);
@@ -0,0 +1,491 @@
+#include "solver.h"
+#include "pool.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include <SDL.h>
+
+#define SOLVER_SPLIT_DEPTH (2)			/* Tree levels expanded up front into tasks. */
+#define SOLVER_TABLE_BITS (18)			/* Transposition entries per worker, log2.	*/
+#define SOLVER_MAX_CLEAR_PER_PIECE (4)
+
+typedef struct {
+    tetris_bitboard_t board;
+    int lines;
+    unsigned int score;
+    int depth;
+    tetris_placement_t path[SOLVER_SPLIT_DEPTH];
+} solver_task_t;
+
+typedef struct {
+    uint64_t key;
+    int value;
+} solver_entry_t;
+
+typedef struct {
+    const solver_problem_t *problem;
+    solver_task_t *tasks;
+    int task_count;
+    SDL_atomic_t next_task;
+
+    /* Best value found so far. Read without the lock for pruning, updated under it. */
+    SDL_atomic_t best_value;
+    SDL_mutex *lock;
+    solver_result_t *result;
+
+    unsigned int max_points_per_line;
+} solver_shared_t;
+
+typedef struct {
+    solver_shared_t *shared;
+    solver_entry_t *table;
+    tetris_placement_t path[SOLVER_MAX_QUEUE];
+    uint64_t nodes;
+} solver_worker_t;
+
+/* Value being maximized. For perfect clears, fewer pieces is better. */
+static int solver_value(const solver_problem_t *problem, int lines, unsigned int score, int depth) {
+    switch (problem->goal) {
+        case SOLVER_MAX_LINES:
+            return lines;
+        case SOLVER_MAX_SCORE:
+            return (int) (score - problem->score);
+        default:
+            return problem->queue_length + 1 - depth;
+    }
+}
+
+/* Whether the board can still be emptied with at most the remaining pieces. */
+static bool perfect_clear_possible(const tetris_bitboard_t *board, int remaining) {
+    const int cells = bitboard_cell_count(board);
+    const int rows = bitboard_height(board);
+
+    int pieces;
+    for (pieces = 1; pieces <= remaining; ++pieces) {
+        const int total = cells + 4 * pieces;
+        if (total % BITBOARD_COLUMNS == 0 && total >= rows * BITBOARD_COLUMNS) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Upper bound on the value reachable from this node, for pruning. */
+static int solver_bound(const solver_shared_t *shared, const tetris_bitboard_t *board, int lines, unsigned int score, int depth) {
+    const solver_problem_t *problem = shared->problem;
+    const int remaining = problem->queue_length - depth;
+    const int more_lines = (bitboard_cell_count(board) + 4 * remaining) / BITBOARD_COLUMNS;
+
+    switch (problem->goal) {
+        case SOLVER_MAX_LINES:
+            return lines + more_lines;
+        case SOLVER_MAX_SCORE: {
+            /* Points per line only go up once the score crosses into the faster fall time. */
+            long long points = (long long) more_lines * (score_for_clears(score, SOLVER_MAX_CLEAR_PER_PIECE) / SOLVER_MAX_CLEAR_PER_PIECE + 1);
+            if (score + points >= FALL_TIME_SCORE_RANGE) {
+                points = (long long) more_lines * shared->max_points_per_line;
+            }
+
+            const long long bound = (long long) (score - problem->score) + points;
+            return bound > INT_MAX ? INT_MAX : (int) bound;
+        }
+        default:
+            if (!perfect_clear_possible(board, remaining)) {
+                return INT_MIN;
+            }
+            return problem->queue_length - depth;
+    }
+}
+
+static void solver_offer(solver_worker_t *worker, int value, int lines, unsigned int score, int depth) {
+    solver_shared_t *shared = worker->shared;
+
+    if (value <= SDL_AtomicGet(&shared->best_value)) {
+        return;
+    }
+
+    SDL_LockMutex(shared->lock);
+    if (value > SDL_AtomicGet(&shared->best_value)) {
+        solver_result_t *result = shared->result;
+
+        result->found = true;
+        result->lines = lines;
+        result->score = score - shared->problem->score;
+        result->placement_count = depth;
+        memcpy(result->placements, worker->path, sizeof(*worker->path) * depth);
+
+        SDL_AtomicSet(&shared->best_value, value);
+    }
+    SDL_UnlockMutex(shared->lock);
+}
+
+/* Returns true if this exact position was already searched with at least as good a value. */
+static bool solver_dominated(solver_worker_t *worker, const tetris_bitboard_t *board, int depth, int value) {
+    const uint64_t key = (bitboard_hash(board) ^ ((uint64_t) depth * 0x9e3779b97f4a7c15ull)) | 1;
+    solver_entry_t *entry = &worker->table[key & ((1u << SOLVER_TABLE_BITS) - 1)];
+
+    if (entry->key == key && entry->value >= value) {
+        return true;
+    }
+
+    entry->key = key;
+    entry->value = value;
+    return false;
+}
+
+typedef struct {
+    tetris_bitboard_t board;
+    tetris_placement_t placement;
+    int cleared;
+    int order;
+} solver_child_t;
+
+/**
+ * Places the piece everywhere it can go, drops placements that leave the same
+ * board as an earlier one, and sorts the rest so that promising boards (more
+ * lines, fewer holes, lower stack) are searched first. Finding a good
+ * solution early is what lets the shared bound prune the rest of the tree.
+ */
+static int solver_expand(const tetris_bitboard_t *board, tetris_shape_kind_t shape, solver_child_t children[BITBOARD_MAX_PLACEMENTS]) {
+    tetris_placement_t placements[BITBOARD_MAX_PLACEMENTS];
+    const tetris_orientation_t *orientations[BITBOARD_MAX_PLACEMENTS];
+    uint64_t seen[BITBOARD_MAX_PLACEMENTS];
+
+    const int count = bitboard_enumerate(board, shape, placements, orientations);
+    int kept = 0;
+
+    int i;
+    for (i = 0; i < count; ++i) {
+        solver_child_t *child = &children[kept];
+
+        child->board = *board;
+        child->cleared = bitboard_place(&child->board, orientations[i], placements[i].x - 1, placements[i].y - 1);
+        child->placement = placements[i];
+
+        const uint64_t hash = bitboard_hash(&child->board);
+        int j, duplicate = 0;
+        for (j = 0; j < kept; ++j) {
+            if (seen[j] == hash) {
+                duplicate = 1;
+                break;
+            }
+        }
+        if (duplicate) {
+            continue;
+        }
+        seen[kept] = hash;
+
+        child->order = child->cleared * 64 - bitboard_holes(&child->board) * 8 - bitboard_height(&child->board) * 2;
+
+        /* Insertion sort, best first; there are at most a few dozen children. */
+        solver_child_t moved = *child;
+        for (j = kept; j > 0 && children[j - 1].order < moved.order; --j) {
+            children[j] = children[j - 1];
+        }
+        children[j] = moved;
+        ++kept;
+    }
+
+    return kept;
+}
+
+static void solver_search(solver_worker_t *worker, const tetris_bitboard_t *board, int lines, unsigned int score, int depth) {
+    solver_shared_t *shared = worker->shared;
+    const solver_problem_t *problem = shared->problem;
+
+    worker->nodes += 1;
+
+    if (problem->goal != SOLVER_PERFECT_CLEAR) {
+        solver_offer(worker, solver_value(problem, lines, score, depth), lines, score, depth);
+    }
+
+    if (depth == problem->queue_length || solver_bound(shared, board, lines, score, depth) <= SDL_AtomicGet(&shared->best_value)) {
+        return;
+    }
+
+    solver_child_t children[BITBOARD_MAX_PLACEMENTS];
+    const int count = solver_expand(board, problem->queue[depth], children);
+
+    int i;
+    for (i = 0; i < count; ++i) {
+        const solver_child_t *child = &children[i];
+        const int child_lines = lines + child->cleared;
+        const unsigned int child_score = score + score_for_clears(score, child->cleared);
+
+        worker->path[depth] = child->placement;
+
+        if (problem->goal == SOLVER_PERFECT_CLEAR && bitboard_is_empty(&child->board)) {
+            solver_offer(worker, solver_value(problem, child_lines, child_score, depth + 1), child_lines, child_score, depth + 1);
+            continue;
+        }
+
+        /* Score only grows with more points (the fall time shrinks), so a higher value dominates. */
+        if (solver_dominated(worker, &child->board, depth + 1, solver_value(problem, child_lines, child_score, depth + 1))) {
+            continue;
+        }
+
+        solver_search(worker, &child->board, child_lines, child_score, depth + 1);
+    }
+}
+
+static void solver_worker_main(void *data, int index) {
+    solver_shared_t *shared = data;
+    solver_worker_t worker;
+
+    memset(&worker, 0, sizeof worker);
+    worker.shared = shared;
+    worker.table = calloc((size_t) 1 << SOLVER_TABLE_BITS, sizeof(*worker.table));
+    if (worker.table == NULL) {
+        fprintf(stderr, "Solver worker %d ran out of memory\n", index);
+        return;
+    }
+
+    int task;
+    while ((task = SDL_AtomicAdd(&shared->next_task, 1)) < shared->task_count) {
+        const solver_task_t *t = &shared->tasks[task];
+
+        memcpy(worker.path, t->path, sizeof(*t->path) * t->depth);
+        solver_search(&worker, &t->board, t->lines, t->score, t->depth);
+    }
+
+    SDL_LockMutex(shared->lock);
+    shared->result->nodes += worker.nodes;
+    SDL_UnlockMutex(shared->lock);
+
+    free(worker.table);
+}
+
+/* Expands the first levels of the tree breadth first. Leaves that end early become tasks too. */
+static int solver_split(solver_shared_t *shared, solver_worker_t *seed) {
+    const solver_problem_t *problem = shared->problem;
+    const int split_depth = problem->queue_length < SOLVER_SPLIT_DEPTH ? problem->queue_length : SOLVER_SPLIT_DEPTH;
+
+    int capacity = 1, level;
+    for (level = 0; level < split_depth; ++level) {
+        capacity *= BITBOARD_MAX_PLACEMENTS;
+    }
+
+    solver_task_t *tasks = malloc(sizeof(*tasks) * capacity);
+    solver_task_t *next = malloc(sizeof(*next) * capacity);
+    if (tasks == NULL || next == NULL) {
+        free(tasks);
+        free(next);
+        return 1;
+    }
+
+    int count = 1;
+    memset(&tasks[0], 0, sizeof tasks[0]);
+    tasks[0].board = problem->board;
+    tasks[0].score = problem->score;
+
+    for (level = 0; level < split_depth; ++level) {
+        int next_count = 0;
+
+        int i;
+        for (i = 0; i < count; ++i) {
+            const solver_task_t *parent = &tasks[i];
+
+            if (parent->depth < level) {
+                next[next_count++] = *parent;
+                continue;
+            }
+
+            solver_child_t expanded[BITBOARD_MAX_PLACEMENTS];
+            const int children = solver_expand(&parent->board, problem->queue[level], expanded);
+
+            int j;
+            for (j = 0; j < children; ++j) {
+                solver_task_t *child = &next[next_count++];
+                *child = *parent;
+
+                child->board = expanded[j].board;
+                child->lines += expanded[j].cleared;
+                child->score += score_for_clears(parent->score, expanded[j].cleared);
+                child->path[level] = expanded[j].placement;
+                child->depth = level + 1;
+
+                /* A perfect clear this early ends the branch; record it now. */
+                if (problem->goal == SOLVER_PERFECT_CLEAR && bitboard_is_empty(&child->board)) {
+                    memcpy(seed->path, child->path, sizeof(*child->path) * child->depth);
+                    solver_offer(seed, solver_value(problem, child->lines, child->score, child->depth),
+                                 child->lines, child->score, child->depth);
+                    --next_count;
+                }
+            }
+
+            /* A topped out parent still counts for the line and score goals. */
+            if (children == 0 && problem->goal != SOLVER_PERFECT_CLEAR) {
+                memcpy(seed->path, parent->path, sizeof(*parent->path) * parent->depth);
+                solver_offer(seed, solver_value(problem, parent->lines, parent->score, parent->depth),
+                             parent->lines, parent->score, parent->depth);
+            }
+        }
+
+        solver_task_t *swap = tasks;
+        tasks = next;
+        next = swap;
+        count = next_count;
+    }
+
+    free(next);
+    shared->tasks = tasks;
+    shared->task_count = count;
+
+    return 0;
+}
+
+int solver_solve(const solver_problem_t *problem, solver_result_t *result) {
+    memset(result, 0, sizeof(*result));
+
+    if (problem->queue_length < 0 || problem->queue_length > SOLVER_MAX_QUEUE) {
+        fprintf(stderr, "Solver queue must hold between 0 and %d pieces\n", SOLVER_MAX_QUEUE);
+        return 1;
+    }
+
+    int i;
+    for (i = 0; i < problem->queue_length; ++i) {
+        if (problem->queue[i] >= SHAPE_END) {
+            fputs("Solver queue contains an unknown piece\n", stderr);
+            return 1;
+        }
+    }
+
+    bitboard_init_tables();
+
+    const uint64_t begin = SDL_GetPerformanceCounter();
+
+    solver_shared_t shared;
+    memset(&shared, 0, sizeof shared);
+    shared.problem = problem;
+    shared.result = result;
+    shared.lock = SDL_CreateMutex();
+    shared.max_points_per_line = score_for_clears(FALL_TIME_SCORE_RANGE, SOLVER_MAX_CLEAR_PER_PIECE) / SOLVER_MAX_CLEAR_PER_PIECE + 1;
+    SDL_AtomicSet(&shared.best_value, problem->goal == SOLVER_PERFECT_CLEAR ? 0 : -1);
+
+    tetris_pool_t *pool = shared.lock != NULL ? pool_create(problem->threads) : NULL;
+
+    solver_worker_t seed;
+    memset(&seed, 0, sizeof seed);
+    seed.shared = &shared;
+
+    int status_code = pool == NULL || solver_split(&shared, &seed) != 0;
+
+    if (status_code == 0) {
+        if (problem->goal != SOLVER_PERFECT_CLEAR) {
+            solver_offer(&seed, solver_value(problem, 0, problem->score, 0), 0, problem->score, 0);
+        }
+
+        pool_run(pool, pool_size(pool), solver_worker_main, &shared);
+    }
+
+    result->nodes += shared.task_count;
+    result->seconds = (double) (SDL_GetPerformanceCounter() - begin) / (double) SDL_GetPerformanceFrequency();
+
+    pool_destroy(pool);
+    free(shared.tasks);
+    if (shared.lock != NULL) {
+        SDL_DestroyMutex(shared.lock);
+    }
+
+    return status_code;
+}
+
+/* Board files hold up to BITBOARD_ROWS lines of '.' and '#', aligned to the floor. */
+static int solver_load_board(const char *path, tetris_bitboard_t *board) {
+    FILE *in = fopen(path, "r");
+    if (in == NULL) {
+        printf("Failed to open board file %s\n", path);
+        return 1;
+    }
+
+    uint16_t rows[BITBOARD_ROWS];
+    char line[256];
+    int count = 0;
+
+    while (fgets(line, sizeof line, in) != NULL) {
+        line[strcspn(line, "\r\n")] = 0;
+        if (*line == 0) {
+            continue;
+        }
+
+        if (count == BITBOARD_ROWS || strlen(line) != BITBOARD_COLUMNS) {
+            printf("Board file must have at most %d rows of %d cells\n", BITBOARD_ROWS, BITBOARD_COLUMNS);
+            fclose(in);
+            return 1;
+        }
+
+        uint16_t bits = 0;
+        int col;
+        for (col = 0; col < BITBOARD_COLUMNS; ++col) {
+            if (line[col] != '.' && line[col] != ' ') {
+                bits |= (uint16_t) (1u << col);
+            }
+        }
+        rows[count++] = bits;
+    }
+    fclose(in);
+
+    memset(board, 0, sizeof(*board));
+    memcpy(board->rows + BITBOARD_ROWS - count, rows, sizeof(*rows) * count);
+
+    return 0;
+}
+
+int solver_main(const char *queue, const char *board_path, const char *goal, int threads) {
+    solver_problem_t problem;
+    memset(&problem, 0, sizeof problem);
+    problem.threads = threads;
+
+    if (goal == NULL || strcmp(goal, "lines") == 0) {
+        problem.goal = SOLVER_MAX_LINES;
+    } else if (strcmp(goal, "score") == 0) {
+        problem.goal = SOLVER_MAX_SCORE;
+    } else if (strcmp(goal, "pc") == 0) {
+        problem.goal = SOLVER_PERFECT_CLEAR;
+    } else {
+        printf("Unknown solver goal: %s (expected lines, score or pc)\n", goal);
+        return 1;
+    }
+
+    for (; *queue != 0; ++queue) {
+        if (problem.queue_length == SOLVER_MAX_QUEUE) {
+            printf("The queue can hold at most %d pieces\n", SOLVER_MAX_QUEUE);
+            return 1;
+        }
+
+        const tetris_shape_kind_t shape = shape_from_letter(*queue);
+        if (shape == SHAPE_END) {
+            printf("Unknown piece '%c' (expected one of JLIOSTZ)\n", *queue);
+            return 1;
+        }
+        problem.queue[problem.queue_length++] = shape;
+    }
+
+    if (board_path != NULL && solver_load_board(board_path, &problem.board) != 0) {
+        return 1;
+    }
+
+    solver_result_t result;
+    if (solver_solve(&problem, &result) != 0) {
+        return 1;
+    }
+
+    if (!result.found) {
+        puts("No hard-drop sequence of this queue reaches a perfect clear.");
+    } else {
+        printf("Lines: %d  Score: %u  Pieces: %d\n", result.lines, result.score, result.placement_count);
+
+        int i;
+        for (i = 0; i < result.placement_count; ++i) {
+            const tetris_placement_t *p = &result.placements[i];
+            printf("%2d. %c rotation %d at x=%d y=%d\n", i + 1, shape_letter(p->shape), p->rotation, p->x, p->y);
+        }
+    }
+
+    printf("Searched %llu nodes in %.3fs\n", (unsigned long long) result.nodes, result.seconds);
+    return 0;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "bitboard.h"
+
+/**
+ * Exhaustive search over a known piece queue. Finds the placement sequence
+ * that clears the most lines or scores the most points, or the shortest
+ * sequence that empties the board (a perfect clear). When no perfect clear
+ * exists the search proves it by exhausting every branch. Only hard-drop
+ * placements are enumerated, so slides and spins under overhangs are not
+ * considered.
+ *
+ * The top of the tree is split into tasks that run on a worker pool. Workers
+ * share the best value found so far and prune any branch whose upper bound
+ * cannot beat it.
+ */
+
+#define SOLVER_MAX_QUEUE (32)
+
+typedef enum {
+    SOLVER_MAX_LINES,
+    SOLVER_MAX_SCORE,
+    SOLVER_PERFECT_CLEAR
+} solver_goal_t;
+
+typedef struct {
+    tetris_bitboard_t board;
+    unsigned int score;			/* Score at the start; it sets the fall time used for scoring. */
+    tetris_shape_kind_t queue[SOLVER_MAX_QUEUE];
+    int queue_length;
+    solver_goal_t goal;
+    int threads;				/* 0 for one per CPU. */
+} solver_problem_t;
+
+typedef struct {
+    bool found;					/* False only when no hard-drop sequence gives a perfect clear. */
+    int lines;
+    unsigned int score;			/* Points gained by the sequence. */
+    int placement_count;
+    tetris_placement_t placements[SOLVER_MAX_QUEUE];
+    uint64_t nodes;
+    double seconds;
+} solver_result_t;
+
+int solver_solve(const solver_problem_t *problem, solver_result_t *result);
+
+/* Command line front end: --solve QUEUE [--solve-board FILE] [--solve-goal lines|score|pc]. */
+int solver_main(const char *queue, const char *board_path, const char *goal, int threads);
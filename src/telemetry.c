@@ -0,0 +1,296 @@
+#include "telemetry.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL.h>
+
+_Static_assert(sizeof(tetris_telemetry_record_t) == 48, "telemetry record layout changed");
+
+typedef struct telemetry_chunk {
+    int count;
+    struct telemetry_chunk *next;
+    tetris_telemetry_record_t records[TELEMETRY_CHUNK_RECORDS];
+} telemetry_chunk_t;
+
+/* One per producing thread, reachable through the TLS slot. */
+typedef struct telemetry_slot {
+    telemetry_chunk_t *chunk;
+    struct telemetry_slot *next;
+} telemetry_slot_t;
+
+struct tetris_telemetry {
+    FILE *file;
+    SDL_TLSID tls;
+    SDL_Thread *writer;
+    SDL_mutex *lock;
+    SDL_cond *wake;
+    telemetry_chunk_t *pending_head, *pending_tail;
+    telemetry_chunk_t *free_chunks;
+    telemetry_slot_t *slots;
+    int quit;
+    uint32_t last_game_id;
+};
+
+static telemetry_chunk_t *telemetry_take_chunk(tetris_telemetry_t *telemetry) {
+    telemetry_chunk_t *chunk = telemetry->free_chunks;
+
+    if (chunk != NULL) {
+        telemetry->free_chunks = chunk->next;
+    } else {
+        chunk = malloc(sizeof(*chunk));
+        if (chunk == NULL)
+            return NULL;
+    }
+
+    chunk->count = 0;
+    chunk->next = NULL;
+    return chunk;
+}
+
+static int telemetry_writer_main(void *data) {
+    tetris_telemetry_t *telemetry = data;
+
+    SDL_LockMutex(telemetry->lock);
+    for (;;) {
+        while (telemetry->pending_head == NULL && !telemetry->quit) {
+            SDL_CondWait(telemetry->wake, telemetry->lock);
+        }
+
+        telemetry_chunk_t *chunk = telemetry->pending_head;
+        if (chunk == NULL) {
+            break;
+        }
+
+        telemetry->pending_head = chunk->next;
+        if (telemetry->pending_head == NULL) {
+            telemetry->pending_tail = NULL;
+        }
+
+        SDL_UnlockMutex(telemetry->lock);
+        fwrite(chunk->records, sizeof(*chunk->records), chunk->count, telemetry->file);
+        SDL_LockMutex(telemetry->lock);
+
+        chunk->next = telemetry->free_chunks;
+        telemetry->free_chunks = chunk;
+    }
+    SDL_UnlockMutex(telemetry->lock);
+
+    fflush(telemetry->file);
+    return 0;
+}
+
+/* Must be called with the lock held. */
+static void telemetry_submit(tetris_telemetry_t *telemetry, telemetry_chunk_t *chunk) {
+    chunk->next = NULL;
+    if (telemetry->pending_tail != NULL) {
+        telemetry->pending_tail->next = chunk;
+    } else {
+        telemetry->pending_head = chunk;
+    }
+    telemetry->pending_tail = chunk;
+
+    SDL_CondSignal(telemetry->wake);
+}
+
+/* Game ids only grow within a log, so the last record holds the highest one. */
+static uint32_t telemetry_read_last_game_id(const char *path) {
+    FILE *in = fopen(path, "rb");
+    if (in == NULL) {
+        return 0;
+    }
+
+    tetris_telemetry_header_t header;
+    tetris_telemetry_record_t record;
+    uint32_t game_id = 0;
+
+    if (fread(&header, sizeof header, 1, in) == 1 && memcmp(header.magic, TELEMETRY_MAGIC, sizeof header.magic) == 0
+        && header.record_size == sizeof record && fseek(in, -(long) sizeof record, SEEK_END) == 0
+        && ftell(in) >= (long) sizeof header && fread(&record, sizeof record, 1, in) == 1) {
+        game_id = record.game_id;
+    }
+
+    fclose(in);
+    return game_id;
+}
+
+tetris_telemetry_t *telemetry_open(const char *path) {
+    tetris_telemetry_t *telemetry = calloc(1, sizeof(*telemetry));
+    if (telemetry == NULL)
+        return NULL;
+
+    telemetry->last_game_id = telemetry_read_last_game_id(path);
+    telemetry->file = fopen(path, "ab");
+    if (telemetry->file == NULL) {
+        printf("Failed to open telemetry log %s\n", path);
+        free(telemetry);
+        return NULL;
+    }
+
+    /* Append-only: the header is only written when the file is new. */
+    fseek(telemetry->file, 0, SEEK_END);
+    if (ftell(telemetry->file) == 0) {
+        tetris_telemetry_header_t header;
+        memcpy(header.magic, TELEMETRY_MAGIC, sizeof header.magic);
+        header.version = TELEMETRY_VERSION;
+        header.record_size = sizeof(tetris_telemetry_record_t);
+        fwrite(&header, sizeof header, 1, telemetry->file);
+    }
+
+    telemetry->tls = SDL_TLSCreate();
+    telemetry->lock = SDL_CreateMutex();
+    telemetry->wake = SDL_CreateCond();
+    telemetry->writer = SDL_CreateThread(telemetry_writer_main, "telemetry", telemetry);
+
+    if (telemetry->tls == 0 || telemetry->lock == NULL || telemetry->wake == NULL || telemetry->writer == NULL) {
+        puts("Failed to start telemetry writer");
+        puts(SDL_GetError());
+        if (telemetry->wake != NULL) SDL_DestroyCond(telemetry->wake);
+        if (telemetry->lock != NULL) SDL_DestroyMutex(telemetry->lock);
+        fclose(telemetry->file);
+        free(telemetry);
+        return NULL;
+    }
+
+    return telemetry;
+}
+
+uint32_t telemetry_last_game_id(const tetris_telemetry_t *telemetry) {
+    return telemetry->last_game_id;
+}
+
+static telemetry_slot_t *telemetry_thread_slot(tetris_telemetry_t *telemetry) {
+    telemetry_slot_t *slot = SDL_TLSGet(telemetry->tls);
+    if (slot != NULL) {
+        return slot;
+    }
+
+    slot = calloc(1, sizeof(*slot));
+    if (slot == NULL)
+        return NULL;
+
+    SDL_LockMutex(telemetry->lock);
+    slot->chunk = telemetry_take_chunk(telemetry);
+    slot->next = telemetry->slots;
+    telemetry->slots = slot;
+    SDL_UnlockMutex(telemetry->lock);
+
+    SDL_TLSSet(telemetry->tls, slot, NULL);
+    return slot;
+}
+
+void telemetry_record(tetris_telemetry_t *telemetry, const tetris_telemetry_record_t *record) {
+    if (telemetry == NULL) {
+        return;
+    }
+
+    telemetry_slot_t *slot = telemetry_thread_slot(telemetry);
+    if (slot == NULL || slot->chunk == NULL) {
+        return;
+    }
+
+    telemetry_chunk_t *chunk = slot->chunk;
+    chunk->records[chunk->count++] = *record;
+
+    /* The only time the producer touches the lock: once per full chunk. */
+    if (chunk->count == TELEMETRY_CHUNK_RECORDS) {
+        SDL_LockMutex(telemetry->lock);
+        telemetry_submit(telemetry, chunk);
+        slot->chunk = telemetry_take_chunk(telemetry);
+        SDL_UnlockMutex(telemetry->lock);
+    }
+}
+
+/* Producers must have stopped recording before the log is closed. */
+void telemetry_close(tetris_telemetry_t *telemetry) {
+    if (telemetry == NULL) {
+        return;
+    }
+
+    SDL_LockMutex(telemetry->lock);
+    telemetry_slot_t *slot = telemetry->slots;
+    while (slot != NULL) {
+        telemetry_slot_t *next = slot->next;
+        if (slot->chunk != NULL && slot->chunk->count > 0) {
+            telemetry_submit(telemetry, slot->chunk);
+        } else {
+            free(slot->chunk);
+        }
+        free(slot);
+        slot = next;
+    }
+    telemetry->slots = NULL;
+    telemetry->quit = 1;
+    SDL_CondSignal(telemetry->wake);
+    SDL_UnlockMutex(telemetry->lock);
+
+    SDL_WaitThread(telemetry->writer, NULL);
+
+    while (telemetry->free_chunks != NULL) {
+        telemetry_chunk_t *next = telemetry->free_chunks->next;
+        free(telemetry->free_chunks);
+        telemetry->free_chunks = next;
+    }
+
+    SDL_DestroyCond(telemetry->wake);
+    SDL_DestroyMutex(telemetry->lock);
+    fclose(telemetry->file);
+    free(telemetry);
+}
+
+int telemetry_read(const char *path, tetris_telemetry_record_t **records, int *count) {
+    FILE *in = fopen(path, "rb");
+    if (in == NULL) {
+        printf("Failed to open telemetry log %s\n", path);
+        return 1;
+    }
+
+    tetris_telemetry_header_t header;
+    if (fread(&header, sizeof header, 1, in) != 1 || memcmp(header.magic, TELEMETRY_MAGIC, sizeof header.magic) != 0
+        || header.version != TELEMETRY_VERSION || header.record_size != sizeof(tetris_telemetry_record_t)) {
+        printf("%s is not a telemetry log this build can read\n", path);
+        fclose(in);
+        return 1;
+    }
+
+    fseek(in, 0, SEEK_END);
+    const long size = ftell(in) - (long) sizeof header;
+    fseek(in, sizeof header, SEEK_SET);
+
+    *count = (int) (size / (long) sizeof(tetris_telemetry_record_t));
+    *records = malloc(sizeof(**records) * (*count > 0 ? *count : 1));
+    if (*records == NULL) {
+        fclose(in);
+        return 1;
+    }
+
+    *count = (int) fread(*records, sizeof(**records), *count, in);
+    fclose(in);
+
+    return 0;
+}
+
+int telemetry_export_csv(const char *path, FILE *out) {
+    tetris_telemetry_record_t *records;
+    int count;
+
+    if (telemetry_read(path, &records, &count) != 0) {
+        return 1;
+    }
+
+    fputs("game_id,piece_index,shape,color,spawn_time_ms,lock_time_ms,inputs,rotations,orientation,x,y,"
+          "rows_cleared,stack_height,score_delta\n", out);
+
+    int i;
+    for (i = 0; i < count; ++i) {
+        const tetris_telemetry_record_t *r = &records[i];
+        fprintf(out, "%u,%u,%u,#%06x,%llu,%llu,%u,%u,%u,%d,%d,%u,%u,%u\n",
+                r->game_id, r->piece_index, r->shape, r->color,
+                (unsigned long long) r->spawn_time_ms, (unsigned long long) r->lock_time_ms,
+                r->inputs, r->rotations, r->orientation, r->x, r->y,
+                r->rows_cleared, r->stack_height, r->score_delta);
+    }
+
+    free(records);
+    return 0;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * Per-piece gameplay telemetry.
+ *
+ * Records are appended to a buffer owned by the calling thread without taking
+ * any lock. Full buffers are handed to a background writer thread, which
+ * appends them to the log file with a single fwrite each.
+ *
+ * File layout: a tetris_telemetry_header_t followed by records, all in host
+ * byte order (every platform we ship on is little endian).
+ */
+
+#define TELEMETRY_MAGIC "TTLM"
+#define TELEMETRY_VERSION (1)
+#define TELEMETRY_CHUNK_RECORDS (4096)
+
+typedef struct {
+    char magic[4];
+    uint16_t version;
+    uint16_t record_size;
+} tetris_telemetry_header_t;
+
+typedef struct {
+    uint64_t spawn_time_ms;	/* Since the start of the game.				*/
+    uint64_t lock_time_ms;	/* Since the start of the game.				*/
+    uint32_t game_id;
+    uint32_t piece_index;
+    uint32_t score_delta;
+    uint32_t color;
+    uint16_t inputs;		/* Movement and rotation inputs handled.	*/
+    uint16_t rotations;		/* Rotations that were actually applied.	*/
+    uint8_t rows_cleared;
+    uint8_t stack_height;	/* Filled rows after clears were applied.	*/
+    uint8_t shape;
+    uint8_t orientation;	/* Clockwise quarter turns from spawn.		*/
+    int8_t x, y;			/* Board position the piece locked at.		*/
+    uint8_t reserved[6];
+} tetris_telemetry_record_t;
+
+typedef struct tetris_telemetry tetris_telemetry_t;
+
+tetris_telemetry_t *telemetry_open(const char *path);
+
+/**
+ * Highest game id already in the log when it was opened, 0 for a new log.
+ * Logs are appended to across runs, so new games must be numbered past it.
+ */
+uint32_t telemetry_last_game_id(const tetris_telemetry_t *telemetry);
+
+void telemetry_record(tetris_telemetry_t *telemetry, const tetris_telemetry_record_t *record);
+
+void telemetry_close(tetris_telemetry_t *telemetry);
+
+/* Reads a whole telemetry log into memory. The caller frees *records. */
+int telemetry_read(const char *path, tetris_telemetry_record_t **records, int *count);
+
+int telemetry_export_csv(const char *path, FILE *out);
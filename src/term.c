@@ -0,0 +1,376 @@
+#ifndef _WIN32
+# define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "term.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include <SDL.h>
+
+#ifndef _WIN32
+# include <errno.h>
+# include <unistd.h>
+# include <poll.h>
+# include <signal.h>
+# include <termios.h>
+#endif
+
+#define TERM_CELL_BYTES (32)		/* Worst case for one cell: cursor move, color and two spaces. */
+#define TERM_TEXT_BYTES (4096)		/* Room for the status line and the message. */
+#define TERM_MESSAGE_SIZE (1024)
+#define TERM_INPUT_SIZE (64)
+
+struct tetris_term {
+#ifndef _WIN32
+    struct termios saved;
+    bool restore;
+    bool input_closed;			/* stdin hit EOF or hung up: stop reading it. */
+#endif
+
+    int rows;					/* Size of the frame arrays. */
+    int *shown;					/* What the terminal displays now, -1 when unknown. */
+    int *frame;
+
+    char *out;
+    size_t out_size, out_capacity;
+
+    unsigned int shown_score;
+    int shown_paused;
+    char message[TERM_MESSAGE_SIZE];
+    bool message_pending;
+};
+
+#ifndef _WIN32
+static volatile sig_atomic_t g_term_interrupted;
+static volatile sig_atomic_t g_term_resized;
+
+static void term_on_signal(int sig) {
+    if (sig == SIGWINCH) {
+        g_term_resized = 1;
+    } else {
+        g_term_interrupted = 1;
+    }
+}
+#endif
+
+static void term_append(tetris_term_t *term, const char *text, size_t size) {
+    if (term->out_size + size > term->out_capacity) {
+        return;
+    }
+
+    memcpy(term->out + term->out_size, text, size);
+    term->out_size += size;
+}
+
+static void term_appendf(tetris_term_t *term, const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+
+    const size_t space = term->out_capacity - term->out_size;
+    const int size = vsnprintf(term->out + term->out_size, space, format, args);
+    if (size > 0 && (size_t) size < space) {
+        term->out_size += size;
+    }
+
+    va_end(args);
+}
+
+/* Sends the whole frame in one write(); only a short write makes us go around again. */
+static int term_flush(tetris_term_t *term) {
+    size_t offset = 0;
+
+#ifndef _WIN32
+    while (offset < term->out_size) {
+        const ssize_t count = write(STDOUT_FILENO, term->out + offset, term->out_size - offset);
+        if (count <= 0) {
+            term->out_size = 0;
+            return 1;
+        }
+        offset += count;
+    }
+#else
+    offset = fwrite(term->out, 1, term->out_size, stdout);
+    fflush(stdout);
+#endif
+
+    const int status_code = offset != term->out_size;
+    term->out_size = 0;
+
+    return status_code;
+}
+
+tetris_term_t *term_open(void) {
+    tetris_term_t *term = calloc(1, sizeof(*term));
+    if (term == NULL)
+        return NULL;
+
+    term->out_capacity = TERM_TEXT_BYTES;
+    term->out = malloc(term->out_capacity);
+    if (term->out == NULL) {
+        free(term);
+        return NULL;
+    }
+
+#ifndef _WIN32
+    if (isatty(STDIN_FILENO) && tcgetattr(STDIN_FILENO, &term->saved) == 0) {
+        struct termios raw = term->saved;
+        raw.c_lflag &= ~(ICANON | ECHO);
+        raw.c_cc[VMIN] = 0;
+        raw.c_cc[VTIME] = 0;
+
+        term->restore = tcsetattr(STDIN_FILENO, TCSANOW, &raw) == 0;
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof action);
+    action.sa_handler = term_on_signal;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    sigaction(SIGWINCH, &action, NULL);
+#endif
+
+    /* Anything stdio still holds must land before the alternate screen. */
+    fflush(stdout);
+
+    /* Alternate screen, hidden cursor, cleared. */
+    term_append(term, "\x1b[?1049h\x1b[?25l\x1b[2J", 18);
+    term_flush(term);
+
+    return term;
+}
+
+void term_close(tetris_term_t *term) {
+    if (term == NULL) {
+        return;
+    }
+
+    term_append(term, "\x1b[0m\x1b[?25h\x1b[?1049l", 18);
+    term_flush(term);
+
+#ifndef _WIN32
+    if (term->restore) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &term->saved);
+    }
+    signal(SIGINT, SIG_DFL);
+    signal(SIGTERM, SIG_DFL);
+    signal(SIGWINCH, SIG_DFL);
+#endif
+
+    free(term->shown);
+    free(term->frame);
+    free(term->out);
+    free(term);
+}
+
+void term_show_message(tetris_term_t *term, const char *message) {
+    snprintf(term->message, sizeof term->message, "%s", message);
+    term->message_pending = true;
+}
+
+/* Terminals have no key releases, so every key is a press and release. */
+static int term_push_key(tetris_context_t *ctx, int64_t key) {
+    const uint64_t now = SDL_GetTicks();
+    int status_code;
+
+    if ((status_code = game_push_event(ctx, EVENT_KEYDOWN, key, now, false)) != 0) {
+        return status_code;
+    }
+
+    return game_push_event(ctx, EVENT_KEYUP, key, now, false);
+}
+
+int term_collect_events(tetris_context_t *ctx) {
+#ifndef _WIN32
+    char input[TERM_INPUT_SIZE];
+    int status_code;
+
+    if (g_term_interrupted) {
+        return 1;
+    }
+
+    /* Nothing moves while paused, so sleep on stdin instead of polling it.
+     * Once stdin is gone poll would return at once, so just sleep. */
+    if (ctx->paused && !ctx->needs_redraw) {
+        struct pollfd fd = {STDIN_FILENO, POLLIN, 0};
+        poll(&fd, ctx->term->input_closed ? 0 : 1, IDLE_WAIT_MS);
+    }
+
+    if (g_term_resized) {
+        g_term_resized = 0;
+        ctx->needs_redraw = true;
+        if (ctx->term->shown != NULL) {
+            memset(ctx->term->shown, 0xFF, sizeof(int) * ctx->term->rows * BOARD_COLUMNS);
+        }
+        ctx->term->shown_paused = -1;
+        ctx->term->message_pending = *ctx->term->message != 0;
+    }
+
+    if (ctx->term->input_closed) {
+        return 0;
+    }
+
+    /* Raw mode only applies to a tty: a pipe or file blocks in read unless polled first. */
+    struct pollfd fd = {STDIN_FILENO, POLLIN, 0};
+    if (poll(&fd, 1, 0) <= 0) {
+        return 0;
+    }
+    if (!(fd.revents & POLLIN)) {
+        ctx->term->input_closed = (fd.revents & (POLLHUP | POLLERR | POLLNVAL)) != 0;
+        return 0;
+    }
+
+    const ssize_t count = read(STDIN_FILENO, input, sizeof input);
+    if (count == 0 || (count < 0 && errno != EINTR && errno != EAGAIN)) {
+        ctx->term->input_closed = true;
+        return 0;
+    }
+
+    ssize_t i;
+    for (i = 0; i < count; ++i) {
+        int64_t key = 0;
+
+        if (input[i] == 0x1b && i + 2 < count && input[i + 1] == '[') {
+            switch (input[i + 2]) {
+                case 'A': key = SDLK_r; break;
+                case 'B': key = SDLK_DOWN; break;
+                case 'C': key = SDLK_RIGHT; break;
+                case 'D': key = SDLK_LEFT; break;
+                default: break;
+            }
+            i += 2;
+        } else if (input[i] == 0x1b || input[i] == 'p') {
+            key = SDLK_ESCAPE;
+        } else if (input[i] == 'q') {
+            return 1;
+        } else if (input[i] == 'a' || input[i] == 's' || input[i] == 'd' || input[i] == 'r') {
+            key = input[i];
+        }
+
+        if (key != 0 && (status_code = term_push_key(ctx, key)) != 0) {
+            return status_code;
+        }
+    }
+#endif
+
+    return 0;
+}
+
+static int term_prepare(tetris_term_t *term, int rows) {
+    if (term->rows == rows) {
+        return 0;
+    }
+
+    const size_t cells = (size_t) rows * BOARD_COLUMNS;
+
+    free(term->shown);
+    free(term->frame);
+    free(term->out);
+
+    term->rows = rows;
+    term->shown = malloc(sizeof(int) * cells);
+    term->frame = malloc(sizeof(int) * cells);
+    term->out_capacity = cells * TERM_CELL_BYTES + TERM_TEXT_BYTES;
+    term->out_size = 0;
+    term->out = malloc(term->out_capacity);
+    term->shown_paused = -1;
+
+    if (term->shown == NULL || term->frame == NULL || term->out == NULL) {
+        puts("Failed to allocate the terminal frame");
+        term->rows = 0;
+        return 1;
+    }
+
+    /* Nothing is known to be on screen yet, so the first frame draws everything. */
+    memset(term->shown, 0xFF, sizeof(int) * cells);
+    term->shown_score = ~0u;
+
+    return 0;
+}
+
+int term_draw(tetris_context_t *ctx) {
+    tetris_term_t *term = ctx->term;
+    const tetris_board_t *board = &ctx->board;
+
+    if (!ctx->needs_redraw) {
+        return 0;
+    }
+
+    if (term_prepare(term, board->rows) != 0) {
+        return 1;
+    }
+
+    int x, y;
+    for (y = 0; y < board->rows; ++y) {
+        memcpy(&term->frame[y * BOARD_COLUMNS], board->row[y], sizeof(int) * BOARD_COLUMNS);
+    }
+
+    const tetris_piece_t *piece = board->current_piece;
+    if (piece != NULL) {
+        for (y = 0; y < piece->h; ++y) {
+            for (x = 0; x < piece->w; ++x) {
+                if (piece->draw_data[y * piece->w + x]) {
+                    term->frame[(piece->y + y) * BOARD_COLUMNS + piece->x + x] = piece->color;
+                }
+            }
+        }
+    }
+
+    /* Cursor and color the terminal will have after what was appended so far. */
+    int cursor = -1, color = -1;
+
+    int i;
+    for (i = 0; i < board->rows * BOARD_COLUMNS; ++i) {
+        const int cell = term->frame[i];
+        if (cell == term->shown[i]) {
+            continue;
+        }
+
+        if (cursor != i) {
+            term_appendf(term, "\x1b[%d;%dH", i / BOARD_COLUMNS + 1, i % BOARD_COLUMNS * 2 + 1);
+        }
+        if (color != cell) {
+            term_appendf(term, "\x1b[48;2;%d;%d;%dm", (cell >> 16) & 0xFF, (cell >> 8) & 0xFF, cell & 0xFF);
+            color = cell;
+        }
+        term_append(term, "  ", 2);
+
+        term->shown[i] = cell;
+        cursor = (i + 1) % BOARD_COLUMNS == 0 ? -1 : i + 1;
+    }
+
+    const int text_row = board->rows + 1;
+
+    if (ctx->score != term->shown_score || ctx->paused != term->shown_paused) {
+        term_appendf(term, "\x1b[0m\x1b[%d;1HScore: %u%s\x1b[K", text_row, ctx->score, ctx->paused ? "  (paused)" : "");
+        term->shown_score = ctx->score;
+        term->shown_paused = ctx->paused;
+    }
+
+    if (term->message_pending) {
+        term_appendf(term, "\x1b[0m\x1b[%d;1H\x1b[J", text_row + 2);
+
+        /* Cursor addressing only, since raw mode may have turned off newline translation. */
+        const char *line = term->message;
+        int row = text_row + 2;
+        while (*line != 0) {
+            const size_t length = strcspn(line, "\n");
+            term_appendf(term, "\x1b[%d;1H%.*s", row++, (int) length, line);
+            line += length + (line[length] == '\n');
+        }
+
+        term->message_pending = false;
+    }
+
+    const int status_code = term_flush(term);
+    ctx->needs_redraw = false;
+
+    startup_mark(&ctx->startup, "first frame");
+    startup_print(&ctx->startup);
+
+    return status_code;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "engine.h"
+
+/**
+ * Terminal frontend for machines without a display. Cells are drawn as two
+ * spaces on an ANSI truecolor background, so any terminal reached over SSH
+ * will do. Each frame only rewrites the cells that changed since the
+ * previous one, with cursor addressing, and goes out in a single write().
+ *
+ * Keys: arrows or a/s/d to move, up or r to rotate, p or Esc to pause, q to quit.
+ */
+
+/* Switches the terminal to raw input and the alternate screen. */
+tetris_term_t *term_open(void);
+
+/* Restores the terminal. */
+void term_close(tetris_term_t *term);
+
+int term_collect_events(tetris_context_t *ctx);
+
+int term_draw(tetris_context_t *ctx);
+
+/* Shown under the board until the next message. */
+void term_show_message(tetris_term_t *term, const char *message);
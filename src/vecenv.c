@@ -0,0 +1,277 @@
+#include "vecenv.h"
+#include "pool.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <SDL.h>
+
+struct tetris_vecenv {
+    int count;
+    tetris_pool_t *pool;
+
+    /* One entry (or one fixed size group of entries) per environment. */
+    uint16_t *rows;
+    uint8_t *pieces;
+    uint8_t *masks;
+    uint32_t *scores;
+    uint64_t *rng;
+
+    /* Arguments of the step in progress. */
+    const int *actions;
+    float *rewards;
+    uint8_t *dones;
+};
+
+/* xorshift64*, one state per environment so chunks never share a generator. */
+static uint8_t vecenv_random_piece(uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+
+    const uint32_t high = (uint32_t) ((x * 0x2545F4914F6CDD1Dull) >> 32);
+    return (uint8_t) (((uint64_t) high * SHAPE_END) >> 32);
+}
+
+static bool vecenv_spawn_fits(const tetris_bitboard_t *board, uint8_t piece) {
+    return bitboard_fits(board, bitboard_rotation(piece, 0), PIECE_SPAWN_X - 1, PIECE_SPAWN_Y - 1);
+}
+
+static void vecenv_update_mask(tetris_vecenv_t *env, int i) {
+    const tetris_bitboard_t *board = (const tetris_bitboard_t *) &env->rows[i * BITBOARD_ROWS];
+    const uint8_t piece = env->pieces[i * VECENV_PIECES];
+    uint8_t *mask = &env->masks[i * VECENV_ACTIONS];
+
+    int rotation;
+    for (rotation = 0; rotation < 4; ++rotation) {
+        const tetris_orientation_t *o = bitboard_rotation(piece, rotation);
+
+        int col;
+        for (col = 0; col < BITBOARD_COLUMNS; ++col) {
+            /* A hard drop is possible wherever the piece fits at the top. */
+            mask[rotation * BITBOARD_COLUMNS + col] = bitboard_fits(board, o, col, 0);
+        }
+    }
+}
+
+static void vecenv_reset_one(tetris_vecenv_t *env, int i) {
+    memset(&env->rows[i * BITBOARD_ROWS], 0, sizeof(*env->rows) * BITBOARD_ROWS);
+    env->scores[i] = 0;
+
+    int k;
+    for (k = 0; k < VECENV_PIECES; ++k) {
+        env->pieces[i * VECENV_PIECES + k] = vecenv_random_piece(&env->rng[i]);
+    }
+
+    vecenv_update_mask(env, i);
+}
+
+static void vecenv_step_one(tetris_vecenv_t *env, int i) {
+    tetris_bitboard_t *board = (tetris_bitboard_t *) &env->rows[i * BITBOARD_ROWS];
+    uint8_t *pieces = &env->pieces[i * VECENV_PIECES];
+    const int action = env->actions[i];
+
+    env->rewards[i] = 0.0f;
+    env->dones[i] = 1;
+
+    if (action >= 0 && action < VECENV_ACTIONS && env->masks[i * VECENV_ACTIONS + action]) {
+        const tetris_orientation_t *o = bitboard_rotation(pieces[0], action / BITBOARD_COLUMNS);
+        const int col = action % BITBOARD_COLUMNS;
+        const int lines = bitboard_place(board, o, col, bitboard_drop_row(board, o, col));
+
+        const unsigned int points = score_for_clears(env->scores[i], lines);
+        env->scores[i] += points;
+        env->rewards[i] = (float) points;
+
+        memmove(pieces, pieces + 1, VECENV_PIECES - 1);
+        pieces[VECENV_PIECES - 1] = vecenv_random_piece(&env->rng[i]);
+
+        /* Same loss rule as the game: the next piece overlaps the stack where it spawns. */
+        env->dones[i] = !vecenv_spawn_fits(board, pieces[0]);
+    }
+
+    if (env->dones[i]) {
+        vecenv_reset_one(env, i);
+    } else {
+        vecenv_update_mask(env, i);
+    }
+}
+
+static void vecenv_step_chunk(void *data, int index) {
+    tetris_vecenv_t *env = data;
+    const int end = (index + 1) * VECENV_CHUNK < env->count ? (index + 1) * VECENV_CHUNK : env->count;
+
+    int i;
+    for (i = index * VECENV_CHUNK; i < end; ++i) {
+        vecenv_step_one(env, i);
+    }
+}
+
+static void vecenv_reset_chunk(void *data, int index) {
+    tetris_vecenv_t *env = data;
+    const int end = (index + 1) * VECENV_CHUNK < env->count ? (index + 1) * VECENV_CHUNK : env->count;
+
+    int i;
+    for (i = index * VECENV_CHUNK; i < end; ++i) {
+        vecenv_reset_one(env, i);
+    }
+}
+
+static int vecenv_chunk_count(const tetris_vecenv_t *env) {
+    return (env->count + VECENV_CHUNK - 1) / VECENV_CHUNK;
+}
+
+tetris_vecenv_t *vecenv_create(int count, uint64_t seed, int threads) {
+    if (count <= 0) {
+        puts("The environment needs at least one game");
+        return NULL;
+    }
+
+    tetris_vecenv_t *env = calloc(1, sizeof(*env));
+    if (env == NULL)
+        return NULL;
+
+    bitboard_init_tables();
+
+    env->count = count;
+    env->rows = malloc(sizeof(*env->rows) * BITBOARD_ROWS * count);
+    env->pieces = malloc(sizeof(*env->pieces) * VECENV_PIECES * count);
+    env->masks = malloc(sizeof(*env->masks) * VECENV_ACTIONS * count);
+    env->scores = malloc(sizeof(*env->scores) * count);
+    env->rng = malloc(sizeof(*env->rng) * count);
+    env->pool = pool_create(threads);
+
+    if (env->rows == NULL || env->pieces == NULL || env->masks == NULL || env->scores == NULL
+        || env->rng == NULL || env->pool == NULL) {
+        puts("Failed to allocate the environment");
+        vecenv_destroy(env);
+        return NULL;
+    }
+
+    /* splitmix64 spreads one seed into independent, never zero, generator states. */
+    int i;
+    for (i = 0; i < count; ++i) {
+        uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        z ^= z >> 31;
+        env->rng[i] = z != 0 ? z : 1;
+    }
+
+    vecenv_reset(env);
+
+    return env;
+}
+
+void vecenv_destroy(tetris_vecenv_t *env) {
+    if (env == NULL) {
+        return;
+    }
+
+    pool_destroy(env->pool);
+    free(env->rows);
+    free(env->pieces);
+    free(env->masks);
+    free(env->scores);
+    free(env->rng);
+    free(env);
+}
+
+int vecenv_count(const tetris_vecenv_t *env) {
+    return env->count;
+}
+
+void vecenv_reset(tetris_vecenv_t *env) {
+    pool_run(env->pool, vecenv_chunk_count(env), vecenv_reset_chunk, env);
+}
+
+void vecenv_step(tetris_vecenv_t *env, const int *actions, float *rewards, uint8_t *dones) {
+    env->actions = actions;
+    env->rewards = rewards;
+    env->dones = dones;
+
+    pool_run(env->pool, vecenv_chunk_count(env), vecenv_step_chunk, env);
+}
+
+const uint16_t *vecenv_rows(const tetris_vecenv_t *env) {
+    return env->rows;
+}
+
+const uint8_t *vecenv_pieces(const tetris_vecenv_t *env) {
+    return env->pieces;
+}
+
+const uint8_t *vecenv_masks(const tetris_vecenv_t *env) {
+    return env->masks;
+}
+
+const uint32_t *vecenv_scores(const tetris_vecenv_t *env) {
+    return env->scores;
+}
+
+int vecenv_benchmark(int count, int steps, int threads) {
+    tetris_vecenv_t *env = vecenv_create(count, (uint64_t) SDL_GetPerformanceCounter(), threads);
+    if (env == NULL) {
+        return 1;
+    }
+
+    int *actions = malloc(sizeof(*actions) * count);
+    float *rewards = malloc(sizeof(*rewards) * count);
+    uint8_t *dones = malloc(sizeof(*dones) * count);
+
+    if (actions == NULL || rewards == NULL || dones == NULL) {
+        puts("Failed to allocate the benchmark buffers");
+        free(actions);
+        free(rewards);
+        free(dones);
+        vecenv_destroy(env);
+        return 1;
+    }
+
+    uint64_t picker = 0x853C49E6748FEA9Bull, games = 0, step_ticks = 0;
+    double points = 0;
+
+    int step;
+    for (step = 0; step < steps; ++step) {
+        const uint8_t *masks = vecenv_masks(env);
+
+        /* Random legal actions; choosing them is not part of the timed step. */
+        int i;
+        for (i = 0; i < count; ++i) {
+            const uint8_t *mask = &masks[i * VECENV_ACTIONS];
+            int action = (int) (((picker = picker * 6364136223846793005ull + 1442695040888963407ull) >> 33) % VECENV_ACTIONS);
+
+            int tries;
+            for (tries = 0; tries < VECENV_ACTIONS && !mask[action]; ++tries) {
+                action = (action + 1) % VECENV_ACTIONS;
+            }
+            actions[i] = action;
+        }
+
+        const uint64_t begin = SDL_GetPerformanceCounter();
+        vecenv_step(env, actions, rewards, dones);
+        step_ticks += SDL_GetPerformanceCounter() - begin;
+
+        for (i = 0; i < count; ++i) {
+            games += dones[i];
+            points += rewards[i];
+        }
+    }
+
+    const double seconds = (double) step_ticks / (double) SDL_GetPerformanceFrequency();
+    const double total = (double) count * steps;
+
+    printf("%d games x %d steps on %d threads: %.0f steps/s (%.1f ns per step)\n",
+           count, steps, pool_size(env->pool), seconds > 0 ? total / seconds : 0.0, seconds * 1e9 / total);
+    printf("%llu games finished, %.1f points per step\n", (unsigned long long) games, points / total);
+
+    free(actions);
+    free(rewards);
+    free(dones);
+    vecenv_destroy(env);
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "bitboard.h"
+
+/**
+ * Batched headless environment for training agents. One call steps every
+ * game with one action each; state lives in structure-of-arrays form so the
+ * observations can be handed over as contiguous arrays without copying.
+ *
+ * An action drops the current piece: action = rotation * BITBOARD_COLUMNS +
+ * column of the piece's leftmost cell. Rotations that look alike are the
+ * same move. The reward is the score the game would award for the lines
+ * cleared. A game ends when the next piece cannot spawn or the action is
+ * not legal (see vecenv_masks); it then starts over on its own and the
+ * observation is the first state of the new game.
+ *
+ * Steps are split into chunks of environments that run on a worker pool.
+ */
+
+#define VECENV_ACTIONS (4 * BITBOARD_COLUMNS)
+#define VECENV_PIECES (1 + PIECE_QUEUE_SIZE)	/* Current piece, then the queue. */
+#define VECENV_CHUNK (256)						/* Environments per pool task.	*/
+
+typedef struct tetris_vecenv tetris_vecenv_t;
+
+/* Zero threads uses one per CPU. Each environment draws pieces from its own seeded generator. */
+tetris_vecenv_t *vecenv_create(int count, uint64_t seed, int threads);
+
+void vecenv_destroy(tetris_vecenv_t *env);
+
+int vecenv_count(const tetris_vecenv_t *env);
+
+/* Starts every game over. */
+void vecenv_reset(tetris_vecenv_t *env);
+
+/* actions, rewards and dones hold one entry per environment. */
+void vecenv_step(tetris_vecenv_t *env, const int *actions, float *rewards, uint8_t *dones);
+
+/* Observations, valid until the next step. */
+const uint16_t *vecenv_rows(const tetris_vecenv_t *env);		/* BITBOARD_ROWS per environment, as tetris_bitboard_t.	*/
+const uint8_t *vecenv_pieces(const tetris_vecenv_t *env);		/* VECENV_PIECES per environment.						*/
+const uint8_t *vecenv_masks(const tetris_vecenv_t *env);		/* VECENV_ACTIONS per environment, 1 where legal.		*/
+const uint32_t *vecenv_scores(const tetris_vecenv_t *env);
+
+/* Command line front end: steps count games with random legal actions and reports the rate. */
+int vecenv_benchmark(int count, int steps, int threads);
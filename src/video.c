@@ -0,0 +1,475 @@
+#include "video.h"
+#include "raster.h"
+#include "pool.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <SDL.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define VIDEO_SSE2 1
+#endif
+
+#ifdef _WIN32
+# include <io.h>
+# include <fcntl.h>
+#endif
+
+#define VIDEO_TAIL_MS (1000)		/* Keep the final board on screen for a second. */
+#define VIDEO_SLOTS_PER_THREAD (2)
+
+/* Full range BT.601, 8 bit fixed point, as expected by C420jpeg. */
+#define Y_R 77
+#define Y_G 150
+#define Y_B 29
+#define U_R (-43)
+#define U_G (-85)
+#define U_B 128
+#define V_R 128
+#define V_G (-107)
+#define V_B (-21)
+
+typedef struct {
+    tetris_board_t board;	/* Board before the piece locked.		*/
+    unsigned int score;		/* Score before the piece locked.		*/
+    const tetris_telemetry_record_t *record;
+} video_keyframe_t;
+
+typedef struct {
+    int width, height, fps;
+    size_t frame_size;
+    FILE *out;
+
+    video_keyframe_t *keyframes;
+    int keyframe_count;			/* The last keyframe is the final board. */
+    int frame_count;
+
+    tetris_raster_t **rasters;	/* One per worker. */
+
+    /* Reordering queue: frame n may only be rendered once frame n - slot_count is written. */
+    uint8_t **slots;
+    int *slot_frame;
+    int slot_count;
+    int written;
+    int failed;
+    SDL_mutex *lock;
+    SDL_cond *space;
+    SDL_atomic_t next_frame;
+} video_job_t;
+
+static int clamp_byte(int value) {
+    return value < 0 ? 0 : (value > 255 ? 255 : value);
+}
+
+#ifdef VIDEO_SSE2
+/* Dot product of four RGBA pixels with (r, g, b, 0) weights, one int32 per pixel. */
+static __m128i weigh_pixels(__m128i pixels, __m128i weights) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 lo = _mm_castsi128_ps(_mm_madd_epi16(_mm_unpacklo_epi8(pixels, zero), weights));
+    const __m128 hi = _mm_castsi128_ps(_mm_madd_epi16(_mm_unpackhi_epi8(pixels, zero), weights));
+
+    const __m128i even = _mm_castps_si128(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)));
+    const __m128i odd = _mm_castps_si128(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)));
+
+    return _mm_add_epi32(even, odd);
+}
+#endif
+
+static void convert_luma_row(const uint32_t *src, uint8_t *dst, int width) {
+    int x = 0;
+
+#ifdef VIDEO_SSE2
+    const __m128i weights = _mm_setr_epi16(Y_R, Y_G, Y_B, 0, Y_R, Y_G, Y_B, 0);
+    const __m128i round = _mm_set1_epi32(128);
+
+    for (; x + 8 <= width; x += 8) {
+        __m128i a = weigh_pixels(_mm_loadu_si128((const __m128i *) (src + x)), weights);
+        __m128i b = weigh_pixels(_mm_loadu_si128((const __m128i *) (src + x + 4)), weights);
+
+        a = _mm_srai_epi32(_mm_add_epi32(a, round), 8);
+        b = _mm_srai_epi32(_mm_add_epi32(b, round), 8);
+
+        const __m128i words = _mm_packs_epi32(a, b);
+        _mm_storel_epi64((__m128i *) (dst + x), _mm_packus_epi16(words, words));
+    }
+#endif
+
+    for (; x < width; ++x) {
+        const uint8_t *p = (const uint8_t *) (src + x);
+        dst[x] = clamp_byte((Y_R * p[0] + Y_G * p[1] + Y_B * p[2] + 128) >> 8);
+    }
+}
+
+/* Averages each 2x2 block of the two rows into one U and one V sample. */
+static void convert_chroma_rows(const uint32_t *row0, const uint32_t *row1, uint8_t *u, uint8_t *v, int width) {
+    int x = 0;
+
+#ifdef VIDEO_SSE2
+    const __m128i u_weights = _mm_setr_epi16(U_R, U_G, U_B, 0, U_R, U_G, U_B, 0);
+    const __m128i v_weights = _mm_setr_epi16(V_R, V_G, V_B, 0, V_R, V_G, V_B, 0);
+    const __m128i round = _mm_set1_epi32(128);
+    const __m128i bias = _mm_set1_epi32(128);
+
+    for (; x + 8 <= width; x += 8) {
+        __m128i a = _mm_avg_epu8(_mm_loadu_si128((const __m128i *) (row0 + x)),
+                                 _mm_loadu_si128((const __m128i *) (row1 + x)));
+        __m128i b = _mm_avg_epu8(_mm_loadu_si128((const __m128i *) (row0 + x + 4)),
+                                 _mm_loadu_si128((const __m128i *) (row1 + x + 4)));
+
+        /* Horizontal neighbours: the averages end up in the even pixel lanes. */
+        a = _mm_avg_epu8(a, _mm_srli_epi64(a, 32));
+        b = _mm_avg_epu8(b, _mm_srli_epi64(b, 32));
+
+        const __m128i pixels = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b),
+                                                               _MM_SHUFFLE(2, 0, 2, 0)));
+
+        __m128i cu = weigh_pixels(pixels, u_weights);
+        __m128i cv = weigh_pixels(pixels, v_weights);
+
+        cu = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(cu, round), 8), bias);
+        cv = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(cv, round), 8), bias);
+
+        const __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(cu, cv), _mm_setzero_si128());
+        const int u_lanes = _mm_cvtsi128_si32(bytes);
+        const int v_lanes = _mm_cvtsi128_si32(_mm_srli_si128(bytes, 4));
+
+        memcpy(u + x / 2, &u_lanes, 4);
+        memcpy(v + x / 2, &v_lanes, 4);
+    }
+#endif
+
+    for (; x < width; x += 2) {
+        const uint8_t *p0 = (const uint8_t *) (row0 + x), *p1 = (const uint8_t *) (row1 + x);
+        const int r = (p0[0] + p0[4] + p1[0] + p1[4] + 2) >> 2;
+        const int g = (p0[1] + p0[5] + p1[1] + p1[5] + 2) >> 2;
+        const int b = (p0[2] + p0[6] + p1[2] + p1[6] + 2) >> 2;
+
+        u[x / 2] = clamp_byte(((U_R * r + U_G * g + U_B * b + 128) >> 8) + 128);
+        v[x / 2] = clamp_byte(((V_R * r + V_G * g + V_B * b + 128) >> 8) + 128);
+    }
+}
+
+static void convert_frame(const tetris_raster_t *raster, uint8_t *frame) {
+    const int w = raster->width, h = raster->height;
+    uint8_t *y_plane = frame;
+    uint8_t *u_plane = y_plane + (size_t) w * h;
+    uint8_t *v_plane = u_plane + (size_t) (w / 2) * (h / 2);
+
+    int row;
+    for (row = 0; row < h; row += 2) {
+        const uint32_t *row0 = raster->pixels + (size_t) row * w;
+        const uint32_t *row1 = row0 + w;
+
+        convert_luma_row(row0, y_plane + (size_t) row * w, w);
+        convert_luma_row(row1, y_plane + (size_t) (row + 1) * w, w);
+        convert_chroma_rows(row0, row1, u_plane + (size_t) (row / 2) * (w / 2), v_plane + (size_t) (row / 2) * (w / 2), w);
+    }
+}
+
+static void render_frame(video_job_t *job, tetris_raster_t *raster, int frame) {
+    const uint64_t t = (uint64_t) frame * 1000 / job->fps;
+
+    /* First keyframe whose piece has not locked yet at time t. */
+    int lo = 0, hi = job->keyframe_count - 1;
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if (job->keyframes[mid].record->lock_time_ms > t) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    const video_keyframe_t *key = &job->keyframes[lo];
+    tetris_board_t board = key->board;	/* Shares the keyframe's rows; only the piece is set. */
+    tetris_piece_t piece;
+    int cells[16];
+
+    const tetris_telemetry_record_t *r = key->record;
+    if (r != NULL && t >= r->spawn_time_ms) {
+        memset(&piece, 0, sizeof piece);
+        shape_rotate(r->shape, r->orientation, cells, &piece.w, &piece.h);
+        piece.shape = r->shape;
+        piece.rotation = r->orientation;
+        piece.color = r->color;
+        piece.draw_data = cells;
+        piece.x = r->x;
+
+        /* Only the lock position is recorded, so the fall is interpolated. */
+        const uint64_t span = r->lock_time_ms - r->spawn_time_ms;
+        piece.y = span > 0 ? 1 + (int) ((r->y - 1) * (int64_t) (t - r->spawn_time_ms) / (int64_t) span) : r->y;
+
+        board.current_piece = &piece;
+    }
+
+    raster_draw_board(raster, &board, key->score);
+}
+
+static void video_worker(void *data, int index) {
+    video_job_t *job = data;
+    tetris_raster_t *raster = job->rasters[index];
+
+    int frame;
+    while ((frame = SDL_AtomicAdd(&job->next_frame, 1)) < job->frame_count) {
+        const int slot = frame % job->slot_count;
+
+        SDL_LockMutex(job->lock);
+        while (frame >= job->written + job->slot_count && !job->failed) {
+            SDL_CondWait(job->space, job->lock);
+        }
+        const int failed = job->failed;
+        SDL_UnlockMutex(job->lock);
+
+        if (failed) {
+            break;
+        }
+
+        render_frame(job, raster, frame);
+        convert_frame(raster, job->slots[slot]);
+
+        /* Whoever completes the oldest outstanding frame writes out every frame that is ready. */
+        SDL_LockMutex(job->lock);
+        job->slot_frame[slot] = frame;
+        while (!job->failed && job->slot_frame[job->written % job->slot_count] == job->written) {
+            const int ready = job->written % job->slot_count;
+
+            if (fputs("FRAME\n", job->out) < 0
+                || fwrite(job->slots[ready], 1, job->frame_size, job->out) != job->frame_size) {
+                fputs("Failed to write video frame\n", stderr);
+                job->failed = 1;
+            }
+
+            job->slot_frame[ready] = -1;
+            job->written += 1;
+        }
+        SDL_CondBroadcast(job->space);
+        SDL_UnlockMutex(job->lock);
+    }
+}
+
+static int video_build_keyframes(video_job_t *job, const tetris_telemetry_record_t *records, int count, uint32_t game_id) {
+    job->keyframes = malloc(sizeof(*job->keyframes) * (count + 1));
+    if (job->keyframes == NULL) {
+        return 1;
+    }
+
+    /* Telemetry is only recorded on boards of the standard height. */
+    tetris_board_t board;
+    unsigned int score = 0;
+    if (board_create(&board, BOARD_ROWS) != 0) {
+        return 1;
+    }
+
+    const tetris_telemetry_record_t *previous = NULL;
+
+    int i;
+    for (i = 0; i < count; ++i) {
+        const tetris_telemetry_record_t *r = &records[i];
+        if (r->game_id != game_id) {
+            continue;
+        }
+
+        /* Logs written before ids were unique across runs can reuse an id.
+         * Keyframes must be in lock order, so keep the first such game only. */
+        if (previous != NULL && r->lock_time_ms < previous->lock_time_ms) {
+            fprintf(stderr, "Game %u was recorded more than once in this log, rendering its first recording\n", game_id);
+            break;
+        }
+        previous = r;
+
+        tetris_piece_t piece;
+        int cells[16];
+
+        memset(&piece, 0, sizeof piece);
+        if (r->shape >= SHAPE_END) {
+            fprintf(stderr, "Skipping piece %u: unknown shape %u\n", r->piece_index, r->shape);
+            continue;
+        }
+
+        shape_rotate(r->shape, r->orientation, cells, &piece.w, &piece.h);
+        if (r->x < 1 || r->y < 1 || r->x + piece.w > BOARD_COLUMNS - 1 || r->y + piece.h > BOARD_ROWS - 1) {
+            fprintf(stderr, "Skipping piece %u: position out of the board\n", r->piece_index);
+            continue;
+        }
+
+        video_keyframe_t *key = &job->keyframes[job->keyframe_count];
+        if (board_create(&key->board, BOARD_ROWS) != 0) {
+            board_destroy(&board);
+            return 1;
+        }
+        job->keyframe_count += 1;
+
+        board_copy(&key->board, &board);
+        key->score = score;
+        key->record = r;
+
+        piece.color = r->color;
+        piece.x = r->x;
+        piece.y = r->y;
+        piece.draw_data = cells;
+
+        board.current_piece = &piece;
+        board_fixate_current_piece(&board);
+        board.current_piece = NULL;
+        board_clear_full_rows(&board, piece.y, piece.h, NULL);
+
+        score += r->score_delta;
+    }
+
+    if (job->keyframe_count == 0) {
+        fprintf(stderr, "No pieces recorded for game %u\n", game_id);
+        board_destroy(&board);
+        return 1;
+    }
+
+    const uint64_t duration = job->keyframes[job->keyframe_count - 1].record->lock_time_ms + VIDEO_TAIL_MS;
+
+    video_keyframe_t *last = &job->keyframes[job->keyframe_count++];
+    last->board = board;	/* Takes over the storage. */
+    last->score = score;
+    last->record = NULL;
+
+    job->frame_count = (int) (duration * job->fps / 1000);
+
+    return 0;
+}
+
+static int video_open_output(video_job_t *job, const char *path) {
+    if (strcmp(path, "-") == 0) {
+#ifdef _WIN32
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        job->out = stdout;
+    } else {
+        job->out = fopen(path, "wb");
+        if (job->out == NULL) {
+            fprintf(stderr, "Failed to open %s\n", path);
+            return 1;
+        }
+    }
+
+    fprintf(job->out, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", job->width, job->height, job->fps);
+    return 0;
+}
+
+static void video_job_free(video_job_t *job, int workers) {
+    int i;
+
+    if (job->rasters != NULL) {
+        for (i = 0; i < workers; ++i) {
+            raster_destroy(job->rasters[i]);
+        }
+    }
+
+    if (job->slots != NULL) {
+        for (i = 0; i < job->slot_count; ++i) {
+            free(job->slots[i]);
+        }
+    }
+
+    if (job->out != NULL && job->out != stdout) {
+        fclose(job->out);
+    }
+
+    if (job->space != NULL) SDL_DestroyCond(job->space);
+    if (job->lock != NULL) SDL_DestroyMutex(job->lock);
+
+    free(job->rasters);
+    free(job->slots);
+    free(job->slot_frame);
+
+    for (i = 0; i < job->keyframe_count; ++i) {
+        board_destroy(&job->keyframes[i].board);
+    }
+    free(job->keyframes);
+}
+
+int video_export(const tetris_options_t *options) {
+    tetris_telemetry_record_t *records;
+    int count;
+
+    if (telemetry_read(options->video_input, &records, &count) != 0) {
+        return 1;
+    }
+
+    if (count == 0) {
+        fprintf(stderr, "%s does not contain any pieces\n", options->video_input);
+        free(records);
+        return 1;
+    }
+
+    video_job_t job;
+    memset(&job, 0, sizeof job);
+
+    /* 4:2:0 needs even dimensions. */
+    job.width = options->video_width & ~1;
+    job.height = options->video_height & ~1;
+    job.fps = options->video_fps > 0 ? options->video_fps : FRAMERATE_DEFAULT;
+    job.frame_size = (size_t) job.width * job.height * 3 / 2;
+
+    if (job.width < 16 || job.height < 16) {
+        fputs("Video size must be at least 16x16\n", stderr);
+        free(records);
+        return 1;
+    }
+
+    const uint32_t game_id = options->video_game != 0 ? options->video_game : records[0].game_id;
+
+    tetris_pool_t *pool = pool_create(options->threads);
+    if (pool == NULL) {
+        free(records);
+        return 1;
+    }
+
+    const int workers = pool_size(pool);
+    int status_code = video_build_keyframes(&job, records, count, game_id);
+
+    if (status_code == 0) {
+        job.slot_count = workers * VIDEO_SLOTS_PER_THREAD;
+        job.rasters = calloc(workers, sizeof(*job.rasters));
+        job.slots = calloc(job.slot_count, sizeof(*job.slots));
+        job.slot_frame = malloc(sizeof(*job.slot_frame) * job.slot_count);
+        job.lock = SDL_CreateMutex();
+        job.space = SDL_CreateCond();
+
+        status_code = job.rasters == NULL || job.slots == NULL || job.slot_frame == NULL
+                      || job.lock == NULL || job.space == NULL;
+
+        int i;
+        for (i = 0; status_code == 0 && i < workers; ++i) {
+            job.rasters[i] = raster_create(job.width, job.height);
+            status_code = job.rasters[i] == NULL;
+        }
+
+        for (i = 0; status_code == 0 && i < job.slot_count; ++i) {
+            job.slot_frame[i] = -1;
+            job.slots[i] = malloc(job.frame_size);
+            status_code = job.slots[i] == NULL;
+        }
+    }
+
+    if (status_code == 0) {
+        status_code = video_open_output(&job, options->video_output);
+    }
+
+    if (status_code == 0) {
+        const uint64_t begin = SDL_GetPerformanceCounter();
+
+        pool_run(pool, workers, video_worker, &job);
+        fflush(job.out);
+        status_code = job.failed;
+
+        const double seconds = (double) (SDL_GetPerformanceCounter() - begin) / (double) SDL_GetPerformanceFrequency();
+        fprintf(stderr, "Wrote %d frames (%.1fs of video) in %.2fs using %d threads\n", job.written,
+                (double) job.frame_count / job.fps, seconds, workers);
+    }
+
+    video_job_free(&job, workers);
+    pool_destroy(pool);
+    free(records);
+
+    return status_code;
+}
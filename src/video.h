@@ -0,0 +1,12 @@
+#pragma once
+
+#include "engine.h"
+
+/**
+ * Replays a game recorded in a telemetry log and writes it as a raw
+ * YUV4MPEG2 (Y4M) stream that any local encoder can read.
+ *
+ * Frames are rendered offscreen on a worker pool and handed back through a
+ * bounded reordering queue, so the output is always written in frame order.
+ */
+int video_export(const tetris_options_t *options);
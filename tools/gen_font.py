@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+"""Generate src/font_data.c from the 5x7 glyph table below.
+
+The glyphs are emitted twice: as raw bitmaps (used by renderers that do not go
+through SDL_ttf) and as a tiny TrueType font built with fontTools, which is
+embedded in the binary and opened with SDL_RWFromConstMem.
+
+Usage: python3 tools/gen_font.py > src/font_data.c
+"""
+
+import io
+import sys
+
+from fontTools.fontBuilder import FontBuilder
+from fontTools.pens.ttGlyphPen import TTGlyphPen
+
+GLYPH_W = 5
+GLYPH_H = 7
+PIXEL = 100
+ADVANCE = (GLYPH_W + 1) * PIXEL
+
+GLYPHS = {
+    ' ': ["     ", "     ", "     ", "     ", "     ", "     ", "     "],
+    '!': ["  #  ", "  #  ", "  #  ", "  #  ", "  #  ", "     ", "  #  "],
+    '"': [" # # ", " # # ", "     ", "     ", "     ", "     ", "     "],
+    '#': [" # # ", "#####", " # # ", " # # ", " # # ", "#####", " # # "],
+    '$': ["  #  ", " ####", "# #  ", " ### ", "  # #", "#### ", "  #  "],
+    '%': ["##   ", "##  #", "   # ", "  #  ", " #   ", "#  ##", "   ##"],
+    '&': [" #   ", "# #  ", "# #  ", " #   ", "# # #", "#  # ", " ## #"],
+    "'": ["  #  ", "  #  ", "     ", "     ", "     ", "     ", "     "],
+    '(': ["   # ", "  #  ", " #   ", " #   ", " #   ", "  #  ", "   # "],
+    ')': [" #   ", "  #  ", "   # ", "   # ", "   # ", "  #  ", " #   "],
+    '*': ["     ", "  #  ", "# # #", " ### ", "# # #", "  #  ", "     "],
+    '+': ["     ", "  #  ", "  #  ", "#####", "  #  ", "  #  ", "     "],
+    ',': ["     ", "     ", "     ", "     ", "  #  ", "  #  ", " #   "],
+    '-': ["     ", "     ", "     ", "#####", "     ", "     ", "     "],
+    '.': ["     ", "     ", "     ", "     ", "     ", " ##  ", " ##  "],
+    '/': ["     ", "    #", "   # ", "  #  ", " #   ", "#    ", "     "],
+    '0': [" ### ", "#   #", "#  ##", "# # #", "##  #", "#   #", " ### "],
+    '1': ["  #  ", " ##  ", "  #  ", "  #  ", "  #  ", "  #  ", " ### "],
+    '2': [" ### ", "#   #", "    #", "   # ", "  #  ", " #   ", "#####"],
+    '3': ["#####", "   # ", "  #  ", "   # ", "    #", "#   #", " ### "],
+    '4': ["   # ", "  ## ", " # # ", "#  # ", "#####", "   # ", "   # "],
+    '5': ["#####", "#    ", "#### ", "    #", "    #", "#   #", " ### "],
+    '6': ["  ## ", " #   ", "#    ", "#### ", "#   #", "#   #", " ### "],
+    '7': ["#####", "    #", "   # ", "  #  ", " #   ", " #   ", " #   "],
+    '8': [" ### ", "#   #", "#   #", " ### ", "#   #", "#   #", " ### "],
+    '9': [" ### ", "#   #", "#   #", " ####", "    #", "   # ", " ##  "],
+    ':': ["     ", " ##  ", " ##  ", "     ", " ##  ", " ##  ", "     "],
+    ';': ["     ", " ##  ", " ##  ", "     ", " ##  ", "  #  ", " #   "],
+    '<': ["   # ", "  #  ", " #   ", "#    ", " #   ", "  #  ", "   # "],
+    '=': ["     ", "     ", "#####", "     ", "#####", "     ", "     "],
+    '>': [" #   ", "  #  ", "   # ", "    #", "   # ", "  #  ", " #   "],
+    '?': [" ### ", "#   #", "    #", "   # ", "  #  ", "     ", "  #  "],
+    '@': [" ### ", "#   #", "    #", " ## #", "# # #", "# # #", " ### "],
+    'A': [" ### ", "#   #", "#   #", "#   #", "#####", "#   #", "#   #"],
+    'B': ["#### ", "#   #", "#   #", "#### ", "#   #", "#   #", "#### "],
+    'C': [" ### ", "#   #", "#    ", "#    ", "#    ", "#   #", " ### "],
+    'D': ["###  ", "#  # ", "#   #", "#   #", "#   #", "#  # ", "###  "],
+    'E': ["#####", "#    ", "#    ", "#### ", "#    ", "#    ", "#####"],
+    'F': ["#####", "#    ", "#    ", "#### ", "#    ", "#    ", "#    "],
+    'G': [" ### ", "#   #", "#    ", "# ###", "#   #", "#   #", " ####"],
+    'H': ["#   #", "#   #", "#   #", "#####", "#   #", "#   #", "#   #"],
+    'I': [" ### ", "  #  ", "  #  ", "  #  ", "  #  ", "  #  ", " ### "],
+    'J': ["  ###", "   # ", "   # ", "   # ", "   # ", "#  # ", " ##  "],
+    'K': ["#   #", "#  # ", "# #  ", "##   ", "# #  ", "#  # ", "#   #"],
+    'L': ["#    ", "#    ", "#    ", "#    ", "#    ", "#    ", "#####"],
+    'M': ["#   #", "## ##", "# # #", "# # #", "#   #", "#   #", "#   #"],
+    'N': ["#   #", "#   #", "##  #", "# # #", "#  ##", "#   #", "#   #"],
+    'O': [" ### ", "#   #", "#   #", "#   #", "#   #", "#   #", " ### "],
+    'P': ["#### ", "#   #", "#   #", "#### ", "#    ", "#    ", "#    "],
+    'Q': [" ### ", "#   #", "#   #", "#   #", "# # #", "#  # ", " ## #"],
+    'R': ["#### ", "#   #", "#   #", "#### ", "# #  ", "#  # ", "#   #"],
+    'S': [" ####", "#    ", "#    ", " ### ", "    #", "    #", "#### "],
+    'T': ["#####", "  #  ", "  #  ", "  #  ", "  #  ", "  #  ", "  #  "],
+    'U': ["#   #", "#   #", "#   #", "#   #", "#   #", "#   #", " ### "],
+    'V': ["#   #", "#   #", "#   #", "#   #", "#   #", " # # ", "  #  "],
+    'W': ["#   #", "#   #", "#   #", "# # #", "# # #", "# # #", " # # "],
+    'X': ["#   #", "#   #", " # # ", "  #  ", " # # ", "#   #", "#   #"],
+    'Y': ["#   #", "#   #", "#   #", " # # ", "  #  ", "  #  ", "  #  "],
+    'Z': ["#####", "    #", "   # ", "  #  ", " #   ", "#    ", "#####"],
+    '[': [" ### ", " #   ", " #   ", " #   ", " #   ", " #   ", " ### "],
+    '\\': ["     ", "#    ", " #   ", "  #  ", "   # ", "    #", "     "],
+    ']': [" ### ", "   # ", "   # ", "   # ", "   # ", "   # ", " ### "],
+    '^': ["  #  ", " # # ", "#   #", "     ", "     ", "     ", "     "],
+    '_': ["     ", "     ", "     ", "     ", "     ", "     ", "#####"],
+    '`': [" #   ", "  #  ", "     ", "     ", "     ", "     ", "     "],
+    'a': ["     ", "     ", " ### ", "    #", " ####", "#   #", " ####"],
+    'b': ["#    ", "#    ", "# ## ", "##  #", "#   #", "#   #", "#### "],
+    'c': ["     ", "     ", " ### ", "#    ", "#    ", "#   #", " ### "],
+    'd': ["    #", "    #", " ## #", "#  ##", "#   #", "#   #", " ####"],
+    'e': ["     ", "     ", " ### ", "#   #", "#####", "#    ", " ### "],
+    'f': ["  ## ", " #  #", " #   ", "###  ", " #   ", " #   ", " #   "],
+    'g': ["     ", " ####", "#   #", "#   #", " ####", "    #", " ### "],
+    'h': ["#    ", "#    ", "# ## ", "##  #", "#   #", "#   #", "#   #"],
+    'i': ["  #  ", "     ", " ##  ", "  #  ", "  #  ", "  #  ", " ### "],
+    'j': ["   # ", "     ", "  ## ", "   # ", "   # ", "#  # ", " ##  "],
+    'k': ["#    ", "#    ", "#  # ", "# #  ", "##   ", "# #  ", "#  # "],
+    'l': [" ##  ", "  #  ", "  #  ", "  #  ", "  #  ", "  #  ", " ### "],
+    'm': ["     ", "     ", "## # ", "# # #", "# # #", "#   #", "#   #"],
+    'n': ["     ", "     ", "# ## ", "##  #", "#   #", "#   #", "#   #"],
+    'o': ["     ", "     ", " ### ", "#   #", "#   #", "#   #", " ### "],
+    'p': ["     ", "     ", "#### ", "#   #", "#### ", "#    ", "#    "],
+    'q': ["     ", "     ", " ## #", "#  ##", " ####", "    #", "    #"],
+    'r': ["     ", "     ", "# ## ", "##  #", "#    ", "#    ", "#    "],
+    's': ["     ", "     ", " ####", "#    ", " ### ", "    #", "#### "],
+    't': [" #   ", " #   ", "###  ", " #   ", " #   ", " #  #", "  ## "],
+    'u': ["     ", "     ", "#   #", "#   #", "#   #", "#  ##", " ## #"],
+    'v': ["     ", "     ", "#   #", "#   #", "#   #", " # # ", "  #  "],
+    'w': ["     ", "     ", "#   #", "#   #", "# # #", "# # #", " # # "],
+    'x': ["     ", "     ", "#   #", " # # ", "  #  ", " # # ", "#   #"],
+    'y': ["     ", "     ", "#   #", "#   #", " ####", "    #", " ### "],
+    'z': ["     ", "     ", "#####", "   # ", "  #  ", " #   ", "#####"],
+    '{': ["   # ", "  #  ", "  #  ", " #   ", "  #  ", "  #  ", "   # "],
+    '|': ["  #  ", "  #  ", "  #  ", "  #  ", "  #  ", "  #  ", "  #  "],
+    '}': [" #   ", "  #  ", "  #  ", "   # ", "  #  ", "  #  ", " #   "],
+    '~': ["     ", "     ", " #   ", "# # #", "   # ", "     ", "     "],
+}
+
+FIRST_CHAR = 0x20
+LAST_CHAR = 0x7E
+
+
+def glyph_name(ch):
+    return "space" if ch == ' ' else "uni%04X" % ord(ch)
+
+
+def glyph_outline(rows):
+    # One rectangle per horizontal run of pixels keeps the outline small.
+    pen = TTGlyphPen(None)
+    for row, line in enumerate(rows):
+        top = (GLYPH_H - row) * PIXEL
+        col = 0
+        while col < GLYPH_W:
+            if line[col] != '#':
+                col += 1
+                continue
+            start = col
+            while col < GLYPH_W and line[col] == '#':
+                col += 1
+            x0, x1 = start * PIXEL, col * PIXEL
+            pen.moveTo((x0, top - PIXEL))
+            pen.lineTo((x0, top))
+            pen.lineTo((x1, top))
+            pen.lineTo((x1, top - PIXEL))
+            pen.closePath()
+    return pen.glyph()
+
+
+def left_side_bearing(rows):
+    cols = [line.find('#') for line in rows if '#' in line]
+    return min(cols) * PIXEL if cols else 0
+
+
+def build_ttf():
+    chars = [chr(c) for c in range(FIRST_CHAR, LAST_CHAR + 1)]
+    order = [".notdef"] + [glyph_name(c) for c in chars]
+
+    fb = FontBuilder(1000, isTTF=True)
+    fb.setupGlyphOrder(order)
+    fb.setupCharacterMap({ord(c): glyph_name(c) for c in chars})
+
+    glyphs = {".notdef": TTGlyphPen(None).glyph()}
+    for c in chars:
+        glyphs[glyph_name(c)] = glyph_outline(GLYPHS[c])
+    fb.setupGlyf(glyphs)
+
+    metrics = {".notdef": (ADVANCE, 0)}
+    for c in chars:
+        metrics[glyph_name(c)] = (ADVANCE, left_side_bearing(GLYPHS[c]))
+    fb.setupHorizontalMetrics(metrics)
+    fb.setupHorizontalHeader(ascent=800, descent=-200)
+    fb.setupNameTable({"familyName": "Tetris Pixel", "styleName": "Regular"})
+    fb.setupOS2(sTypoAscender=800, sTypoDescender=-200, usWinAscent=800, usWinDescent=200)
+    fb.setupPost()
+
+    out = io.BytesIO()
+    fb.save(out)
+    return out.getvalue()
+
+
+def main():
+    for c in range(FIRST_CHAR, LAST_CHAR + 1):
+        rows = GLYPHS[chr(c)]
+        assert len(rows) == GLYPH_H and all(len(r) == GLYPH_W for r in rows), chr(c)
+
+    ttf = build_ttf()
+    w = sys.stdout.write
+
+    w("/* Generated by tools/gen_font.py. Do not edit. */\n\n")
+    w('#include "font.h"\n\n')
+
+    w("const uint8_t g_font_glyphs[FONT_GLYPH_COUNT][FONT_GLYPH_HEIGHT] = {\n")
+    for c in range(FIRST_CHAR, LAST_CHAR + 1):
+        bits = []
+        for line in GLYPHS[chr(c)]:
+            value = 0
+            for col, px in enumerate(line):
+                if px == '#':
+                    value |= 1 << (GLYPH_W - 1 - col)
+            bits.append("0x%02x" % value)
+        label = "'\\\\'" if chr(c) == '\\' else ("'\\''" if chr(c) == "'" else "'%s'" % chr(c))
+        w("        {%s}, /* %s */\n" % (", ".join(bits), label))
+    w("};\n\n")
+
+    w("const unsigned char g_font_ttf[] = {\n")
+    for i in range(0, len(ttf), 16):
+        w("        " + ", ".join("0x%02x" % b for b in ttf[i:i + 16]) + ",\n")
+    w("};\n\n")
+    w("const unsigned int g_font_ttf_size = sizeof g_font_ttf;\n")
+
+
+if __name__ == "__main__":
+    main()